@@ -0,0 +1,98 @@
+using System;
+using System.Linq;
+using Apache.Arrow;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+
+namespace KuzuDot.Tests
+{
+    [TestClass]
+    public class ArrowRecordBatchTests
+    {
+        private Database? _database;
+        private Connection? _connection;
+        private string? _initializationError;
+
+        [TestInitialize]
+        public void TestInitialize()
+        {
+            try
+            {
+                _database = new Database(":memory:");
+                _connection = _database.Connect();
+                _connection.Query("CREATE NODE TABLE Item(id INT64, name STRING, PRIMARY KEY(id));").Dispose();
+                for (int i = 0; i < 5; i++)
+                {
+                    _connection.Query($"CREATE (:Item {{id: {i}, name: 'item{i}'}});").Dispose();
+                }
+                _initializationError = null;
+            }
+            catch (KuzuException ex)
+            {
+                _database = null;
+                _connection = null;
+                _initializationError = ex.Message;
+            }
+        }
+
+        [TestCleanup]
+        public void TestCleanup()
+        {
+            _connection?.Dispose();
+            _database?.Dispose();
+        }
+
+        private void EnsureNativeLibraryAvailable()
+        {
+            if (_database == null || _connection == null)
+            {
+                throw new InvalidOperationException($"Cannot run test: Native Kuzu library is not available. Error: {_initializationError}");
+            }
+        }
+
+        [TestMethod]
+        public void GetArrowSchema_ShouldExposeColumns()
+        {
+            EnsureNativeLibraryAvailable();
+            using var result = _connection!.Query("MATCH (i:Item) RETURN i.id, i.name;");
+            var schema = result.GetArrowSchema();
+
+            Assert.AreEqual(2, schema.FieldsList.Count);
+            Assert.AreEqual("i.id", schema.FieldsList[0].Name);
+        }
+
+        [TestMethod]
+        public void ToArrowBatches_ShouldStreamAllRows()
+        {
+            EnsureNativeLibraryAvailable();
+            using var result = _connection!.Query("MATCH (i:Item) RETURN i.id, i.name ORDER BY i.id;");
+
+            long rows = 0, sum = 0;
+            int batches = 0;
+            foreach (var batch in result.ToArrowBatches(2))
+            {
+                using (batch)
+                {
+                    var ids = (Int64Array)batch.Column(0);
+                    var names = (StringArray)batch.Column(1);
+                    for (int i = 0; i < batch.Length; i++) sum += ids.GetValue(i) ?? 0;
+                    Assert.AreEqual($"item{ids.GetValue(0)}", names.GetString(0));
+                    rows += batch.Length;
+                    batches++;
+                }
+            }
+
+            Assert.AreEqual(5L, rows);
+            Assert.AreEqual(3, batches);
+            Assert.AreEqual(10L, sum);
+        }
+
+        [TestMethod]
+        public void ToArrowBatches_WithInvalidChunkSize_ShouldThrow()
+        {
+            EnsureNativeLibraryAvailable();
+            using var result = _connection!.Query("MATCH (i:Item) RETURN i.id;");
+
+            Assert.ThrowsExactly<ArgumentOutOfRangeException>(() => result.ToArrowBatches(0).ToList());
+        }
+    }
+}
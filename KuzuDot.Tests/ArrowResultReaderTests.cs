@@ -0,0 +1,129 @@
+using System;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+
+namespace KuzuDot.Tests
+{
+    [TestClass]
+    public class ArrowResultReaderTests
+    {
+        private Database? _database;
+        private Connection? _connection;
+        private string? _initializationError;
+
+        [TestInitialize]
+        public void TestInitialize()
+        {
+            try
+            {
+                _database = new Database(":memory:");
+                _connection = _database.Connect();
+                _connection.Query("CREATE NODE TABLE Item(id INT64, name STRING, tags STRING[], PRIMARY KEY(id));").Dispose();
+                for (int i = 0; i < 5; i++)
+                {
+                    var name = i == 3 ? "NULL" : $"'item{i}'";
+                    _connection.Query($"CREATE (:Item {{id: {i}, name: {name}, tags: ['a', 'b{i}']}});").Dispose();
+                }
+                _initializationError = null;
+            }
+            catch (KuzuException ex)
+            {
+                _database = null;
+                _connection = null;
+                _initializationError = ex.Message;
+            }
+        }
+
+        [TestCleanup]
+        public void TestCleanup()
+        {
+            _connection?.Dispose();
+            _database?.Dispose();
+        }
+
+        private void EnsureNativeLibraryAvailable()
+        {
+            if (_database == null || _connection == null)
+            {
+                throw new InvalidOperationException($"Cannot run test: Native Kuzu library is not available. Error: {_initializationError}");
+            }
+        }
+
+        [TestMethod]
+        public void TryReadNext_ShouldChunkAllRows()
+        {
+            EnsureNativeLibraryAvailable();
+            using var result = _connection!.Query("MATCH (i:Item) RETURN i.id ORDER BY i.id;");
+            using var reader = result.GetArrowReader(2);
+
+            Assert.AreEqual(1, reader.ColumnCount);
+            long total = 0, chunks = 0, sum = 0;
+            while (reader.TryReadNext(out var chunk))
+            {
+                using (chunk)
+                {
+                    var values = chunk.GetColumn(0).GetValues<long>();
+                    Assert.AreEqual(chunk.Length, values.Length);
+                    foreach (var v in values) sum += v;
+                    total += chunk.Length;
+                    chunks++;
+                }
+            }
+
+            Assert.AreEqual(5L, total);
+            Assert.AreEqual(3L, chunks);
+            Assert.AreEqual(10L, sum);
+        }
+
+        [TestMethod]
+        public void StringColumn_ShouldExposeOffsetsDataAndNulls()
+        {
+            EnsureNativeLibraryAvailable();
+            using var result = _connection!.Query("MATCH (i:Item) RETURN i.name ORDER BY i.id;");
+            using var reader = result.GetArrowReader(100);
+
+            Assert.IsTrue(reader.TryReadNext(out var chunk));
+            using (chunk)
+            {
+                var column = chunk.GetColumn(0);
+                Assert.AreEqual(6, column.GetOffsets().Length);
+                Assert.AreEqual("item0", column.GetString(0));
+                Assert.IsTrue(column.IsNull(3));
+                Assert.IsNull(column.GetString(3));
+                Assert.AreEqual(1L, column.NullCount);
+            }
+            Assert.IsFalse(reader.TryReadNext(out _));
+        }
+
+        [TestMethod]
+        public void ListColumn_ShouldExposeChildValues()
+        {
+            EnsureNativeLibraryAvailable();
+            using var result = _connection!.Query("MATCH (i:Item) WHERE i.id = 2 RETURN i.tags;");
+            using var reader = result.GetArrowReader(10);
+
+            Assert.IsTrue(reader.TryReadNext(out var chunk));
+            using (chunk)
+            {
+                var column = chunk.GetColumn(0);
+                Assert.AreEqual(1, column.ChildCount);
+                var offsets = column.GetOffsets();
+                var values = column.GetChild(0);
+                Assert.AreEqual(2, offsets[1] - offsets[0]);
+                Assert.AreEqual("b2", values.GetString(offsets[0] + 1));
+            }
+        }
+
+        [TestMethod]
+        public void Column_AfterChunkDisposed_ShouldThrow()
+        {
+            EnsureNativeLibraryAvailable();
+            using var result = _connection!.Query("MATCH (i:Item) RETURN i.id;");
+            using var reader = result.GetArrowReader(10);
+            Assert.IsTrue(reader.TryReadNext(out var chunk));
+            var column = chunk.GetColumn(0);
+            chunk.Dispose();
+
+            Assert.ThrowsExactly<ObjectDisposedException>(() => column.Length);
+        }
+    }
+}
@@ -0,0 +1,102 @@
+using System;
+using System.Threading;
+using System.Threading.Tasks;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+
+namespace KuzuDot.Tests
+{
+    [TestClass]
+    public class AsyncQueryTests
+    {
+        private const string LongRunningQuery = "UNWIND range(1, 1000000000) AS x RETURN sum(x);";
+
+        private Database? _database;
+        private Connection? _connection;
+        private string? _initializationError;
+
+        [TestInitialize]
+        public void TestInitialize()
+        {
+            try
+            {
+                _database = new Database(":memory:");
+                _connection = _database.Connect();
+                _connection.Query("CREATE NODE TABLE Person(name STRING, age INT64, PRIMARY KEY(name));").Dispose();
+                _connection.Query("CREATE (:Person {name: 'Alice', age: 30});").Dispose();
+                _initializationError = null;
+            }
+            catch (KuzuException ex)
+            {
+                _database = null;
+                _connection = null;
+                _initializationError = ex.Message;
+            }
+        }
+
+        [TestCleanup]
+        public void TestCleanup()
+        {
+            _connection?.Dispose();
+            _database?.Dispose();
+        }
+
+        private void EnsureNativeLibraryAvailable()
+        {
+            if (_database == null || _connection == null)
+            {
+                throw new InvalidOperationException($"Cannot run test: Native Kuzu library is not available. Error: {_initializationError}");
+            }
+        }
+
+        [TestMethod]
+        public async Task QueryAsync_ShouldReturnResult()
+        {
+            EnsureNativeLibraryAvailable();
+            using var result = await _connection!.QueryAsync("MATCH (p:Person) RETURN p.age;");
+
+            Assert.IsTrue(result.IsSuccess);
+            var reader = result.GetReader();
+            Assert.IsTrue(reader.Read());
+            Assert.AreEqual(30L, reader.GetInt64(0));
+        }
+
+        [TestMethod]
+        public async Task ExecuteAsync_ShouldRunPreparedStatement()
+        {
+            EnsureNativeLibraryAvailable();
+            using var stmt = _connection!.Prepare("MATCH (p:Person) WHERE p.name = $name RETURN p.age;");
+            stmt.BindString("name", "Alice");
+            using var result = await stmt.ExecuteAsync();
+
+            Assert.AreEqual(1UL, result.GetNumTuples());
+        }
+
+        [TestMethod]
+        public async Task QueryAsync_WithCancelledToken_ShouldThrow()
+        {
+            EnsureNativeLibraryAvailable();
+            using var cts = new CancellationTokenSource();
+            cts.Cancel();
+
+            await Assert.ThrowsAsync<OperationCanceledException>(() => _connection!.QueryAsync("MATCH (p:Person) RETURN p.age;", cts.Token));
+        }
+
+        [TestMethod]
+        public async Task QueryAsync_CancelledWhileRunning_ShouldInterrupt()
+        {
+            EnsureNativeLibraryAvailable();
+            using var cts = new CancellationTokenSource(TimeSpan.FromMilliseconds(100));
+
+            await Assert.ThrowsAsync<OperationCanceledException>(() => _connection!.QueryAsync(LongRunningQuery, cts.Token));
+        }
+
+        [TestMethod]
+        public async Task QueryAsync_ExceedingQueryTimeout_ShouldThrowTimeoutException()
+        {
+            EnsureNativeLibraryAvailable();
+            _connection!.SetQueryTimeout(100);
+
+            await Assert.ThrowsExactlyAsync<TimeoutException>(() => _connection.QueryAsync(LongRunningQuery));
+        }
+    }
+}
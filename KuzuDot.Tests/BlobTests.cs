@@ -41,10 +41,12 @@ namespace KuzuDot.Tests
 
         private bool TryInsertBlob(string id, byte[] data)
         {
-            string hex = BitConverter.ToString(data).Replace("-", string.Empty);
+            // BLOB() parses \xHH escapes; the backslash itself is escaped inside the Cypher string literal.
+            var escaped = new System.Text.StringBuilder(data.Length * 5);
+            foreach (var b in data) escaped.Append("\\\\x").Append(b.ToString("X2"));
             try
             {
-                string cypher = $"CREATE (:File {{id: '{id}', data: BLOB('{hex}')}})";
+                string cypher = $"CREATE (:File {{id: '{id}', data: BLOB('{escaped}')}})";
                 using var r = _connection!.Query(cypher);
                 return true;
             }
@@ -86,5 +88,101 @@ namespace KuzuDot.Tests
             Assert.AreEqual(data.Length, fetched.Length);
             for (int i = 0; i < fetched.Length; i++) Assert.AreEqual(data[i], fetched[i]);
         }
+
+        [TestMethod]
+        public void GetBlobIntoSpanMatchesLengthOrInconclusive()
+        {
+            RequireNative();
+            byte[] data = new byte[4096];
+            for (int i = 0; i < data.Length; i++) data[i] = (byte)(i * 31);
+            if (!TryInsertBlob("large", data))
+                Assert.Inconclusive("Blob literal insertion not supported in current engine.");
+
+            using var result = _connection!.Query("MATCH (f:File {id: 'large'}) RETURN f.data");
+            using var row = result.GetNext();
+            using var value = row.GetValue(0);
+            Assert.AreEqual(data.Length, value.GetBlobLength());
+            var buffer = new byte[data.Length + 8];
+            Assert.AreEqual(data.Length, value.GetBlob(buffer));
+            CollectionAssert.AreEqual(data, buffer.AsSpan(0, data.Length).ToArray());
+            Assert.ThrowsExactly<ArgumentException>(() => value.GetBlob(new byte[data.Length - 1]));
+        }
+
+        [TestMethod]
+        public void ReaderGetBlobOrInconclusive()
+        {
+            RequireNative();
+            byte[] data = { 0xDE, 0xAD, 0xBE, 0xEF };
+            if (!TryInsertBlob("reader", data))
+                Assert.Inconclusive("Blob literal insertion not supported in current engine.");
+
+            using var result = _connection!.Query("MATCH (f:File {id: 'reader'}) RETURN f.data");
+            var reader = result.GetReader();
+            Assert.IsTrue(reader.Read());
+            Assert.AreEqual(4, reader.GetBlobLength(0));
+            CollectionAssert.AreEqual(data, reader.GetBlob(0));
+            Span<byte> buffer = stackalloc byte[4];
+            Assert.AreEqual(4, reader.GetBlob(0, buffer));
+            CollectionAssert.AreEqual(data, buffer.ToArray());
+        }
+
+        [TestMethod]
+        public void BindBlobRoundTrip()
+        {
+            RequireNative();
+            byte[] data = new byte[1000];
+            for (int i = 0; i < data.Length; i++) data[i] = (byte)(255 - i % 256);
+            using (var ps = _connection!.Prepare("CREATE (:File {id: $id, data: BLOB($data)})"))
+            {
+                Assert.IsTrue(ps.IsSuccess, ps.ErrorMessage);
+                ps.BindString("id", "bound");
+                ps.BindBlob("data", data);
+                ps.Execute().Dispose();
+            }
+
+            using var result = _connection.Query("MATCH (f:File {id: 'bound'}) RETURN f.data");
+            var reader = result.GetReader();
+            Assert.IsTrue(reader.Read());
+            CollectionAssert.AreEqual(data, reader.GetBlob(0));
+        }
+
+        [TestMethod]
+        public void BindBlobStoresRawBytes()
+        {
+            RequireNative();
+            byte[] data = new byte[256];
+            for (int i = 0; i < data.Length; i++) data[i] = (byte)i;
+            using (var ps = _connection!.Prepare("CREATE (:File {id: 'raw', data: BLOB($data)})"))
+            {
+                ps.BindBlob("data", data);
+                ps.Execute().Dispose();
+            }
+
+            // Every byte value (NUL, quotes, backslash, high bytes) must be stored as itself, not as text.
+            using var result = _connection.Query("MATCH (f:File {id: 'raw'}) RETURN f.data, octet_length(f.data)");
+            var reader = result.GetReader();
+            Assert.IsTrue(reader.Read());
+            Assert.AreEqual(256L, reader.GetInt64(1));
+            Assert.AreEqual(256, reader.GetBlobLength(0));
+            CollectionAssert.AreEqual(data, reader.GetBlob(0));
+        }
+
+        [TestMethod]
+        public void CreateBlobValueRoundTrip()
+        {
+            RequireNative();
+            byte[] data = { 0x00, 0x7F, 0x80, 0xFF };
+            using (var ps = _connection!.Prepare("CREATE (:File {id: 'value', data: BLOB($data)})"))
+            using (var value = KuzuValue.CreateBlob(data))
+            {
+                ps.BindValue("data", value);
+                ps.Execute().Dispose();
+            }
+
+            using var result = _connection.Query("MATCH (f:File {id: 'value'}) RETURN f.data");
+            using var row = result.GetNext();
+            using var fetched = row.GetValue(0);
+            CollectionAssert.AreEqual(data, fetched.GetBlob());
+        }
     }
 }
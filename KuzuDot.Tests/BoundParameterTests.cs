@@ -0,0 +1,111 @@
+using System;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+
+namespace KuzuDot.Tests
+{
+    [TestClass]
+    public class BoundParameterTests
+    {
+        private Database? _database;
+        private Connection? _connection;
+        private string? _initializationError;
+
+        [TestInitialize]
+        public void TestInitialize()
+        {
+            try
+            {
+                _database = new Database(":memory:");
+                _connection = _database.Connect();
+                _connection.Query("CREATE NODE TABLE Person(name STRING, age INT64, PRIMARY KEY(name));").Dispose();
+                _initializationError = null;
+            }
+            catch (KuzuException ex)
+            {
+                _database = null;
+                _connection = null;
+                _initializationError = ex.Message;
+            }
+        }
+
+        [TestCleanup]
+        public void TestCleanup()
+        {
+            _connection?.Dispose();
+            _database?.Dispose();
+        }
+
+        private void EnsureNativeLibraryAvailable()
+        {
+            if (_database == null || _connection == null)
+            {
+                throw new InvalidOperationException($"Cannot run test: Native Kuzu library is not available. Error: {_initializationError}");
+            }
+        }
+
+        [TestMethod]
+        public void GetParameter_ShouldBindAcrossExecutions()
+        {
+            EnsureNativeLibraryAvailable();
+            using var stmt = _connection!.Prepare("CREATE (:Person {name: $name, age: $age});");
+            var name = stmt.GetParameter("name");
+            var age = stmt.GetParameter("age");
+
+            for (int i = 0; i < 10; i++)
+            {
+                name.BindString("p" + i);
+                age.BindInt64(i);
+                stmt.Execute().Dispose();
+            }
+
+            using var result = _connection.Query("MATCH (p:Person) RETURN sum(p.age);");
+            var reader = result.GetReader();
+            Assert.IsTrue(reader.Read());
+            Assert.AreEqual(45L, reader.GetInt64(0));
+        }
+
+        [TestMethod]
+        public void GetParameter_ShouldMixWithNamedBinds()
+        {
+            EnsureNativeLibraryAvailable();
+            using var stmt = _connection!.Prepare("RETURN $x + $y;");
+            stmt.GetParameter("x").BindInt64(40);
+            stmt.BindInt64("y", 2);
+
+            using var result = stmt.Execute();
+            var reader = result.GetReader();
+            Assert.IsTrue(reader.Read());
+            Assert.AreEqual(42L, reader.GetInt64(0));
+            Assert.AreEqual("x", stmt.GetParameter("x").Name);
+        }
+
+        [TestMethod]
+        public void BoundParameter_AfterStatementDisposed_ShouldThrow()
+        {
+            EnsureNativeLibraryAvailable();
+            var stmt = _connection!.Prepare("RETURN $x;");
+            var x = stmt.GetParameter("x");
+            stmt.Dispose();
+
+            Assert.ThrowsExactly<ObjectDisposedException>(() => x.BindInt64(1));
+        }
+
+        [TestMethod]
+        public void BoundParameter_Default_ShouldThrow()
+        {
+            EnsureNativeLibraryAvailable();
+            var x = default(BoundParameter);
+
+            Assert.ThrowsExactly<InvalidOperationException>(() => x.BindInt64(1));
+        }
+
+        [TestMethod]
+        public void GetParameter_WithEmptyName_ShouldThrow()
+        {
+            EnsureNativeLibraryAvailable();
+            using var stmt = _connection!.Prepare("RETURN $x;");
+
+            Assert.ThrowsExactly<ArgumentException>(() => stmt.GetParameter(""));
+        }
+    }
+}
@@ -0,0 +1,216 @@
+using System;
+using System.Collections.Generic;
+using System.Data;
+using System.Linq;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+
+namespace KuzuDot.Tests
+{
+    [TestClass]
+    public class BulkLoaderTests
+    {
+        private Database? _database;
+        private Connection? _connection;
+        private string? _initializationError;
+
+        private sealed record PersonRow(long Id, string? Name, double? Score);
+        private sealed record EventRow(long Id, TimeSpan? Duration);
+        private sealed class EmptyRow { }
+
+        private sealed class MixedRow
+        {
+            public long Id;
+            public string? Name { get; set; }
+        }
+
+        [TestInitialize]
+        public void TestInitialize()
+        {
+            try
+            {
+                _database = new Database(":memory:");
+                _connection = _database.Connect();
+                _connection.Query("CREATE NODE TABLE Person(id INT64, name STRING, score DOUBLE, PRIMARY KEY(id));").Dispose();
+                _initializationError = null;
+            }
+            catch (KuzuException ex)
+            {
+                _database = null;
+                _connection = null;
+                _initializationError = ex.Message;
+            }
+        }
+
+        [TestCleanup]
+        public void TestCleanup()
+        {
+            _connection?.Dispose();
+            _database?.Dispose();
+        }
+
+        private void EnsureNativeLibraryAvailable()
+        {
+            if (_database == null || _connection == null)
+            {
+                throw new InvalidOperationException($"Cannot run test: Native Kuzu library is not available. Error: {_initializationError}");
+            }
+        }
+
+        private long CountPeople()
+        {
+            using var result = _connection!.Query("MATCH (p:Person) RETURN count(p);");
+            var reader = result.GetReader();
+            Assert.IsTrue(reader.Read());
+            return reader.GetInt64(0);
+        }
+
+        [TestMethod]
+        public void Load_Records_ShouldCopyAllRowsInBatches()
+        {
+            EnsureNativeLibraryAvailable();
+            var rows = Enumerable.Range(0, 25).Select(i => new PersonRow(i, "p" + i, i * 0.5));
+            var loader = _connection!.CreateBulkLoader(new BulkLoadOptions { BatchSize = 10 });
+
+            var result = loader.Load("Person", rows);
+
+            Assert.AreEqual(25, result.RowsLoaded);
+            Assert.AreEqual(3, result.Batches);
+            Assert.AreEqual(25, CountPeople());
+        }
+
+        [TestMethod]
+        public void Load_Records_ShouldRoundTripNullsQuotesAndEmptyStrings()
+        {
+            EnsureNativeLibraryAvailable();
+            var rows = new[] { new PersonRow(1, "say \"hi\", ok", null), new PersonRow(2, "", 1.5), new PersonRow(3, null, null) };
+
+            _connection!.CreateBulkLoader().Load("Person", rows);
+
+            using var result = _connection.Query("MATCH (p:Person) RETURN p.id, p.name, p.score ORDER BY p.id;");
+            var reader = result.GetReader();
+            Assert.IsTrue(reader.Read());
+            Assert.AreEqual("say \"hi\", ok", reader.GetString(1));
+            Assert.IsTrue(reader.IsNull(2));
+            Assert.IsTrue(reader.Read());
+            Assert.AreEqual(string.Empty, reader.GetString(1));
+            Assert.AreEqual(1.5, reader.GetDouble(2));
+            Assert.IsTrue(reader.Read());
+            Assert.IsTrue(reader.IsNull(1));
+        }
+
+        [TestMethod]
+        public void Load_MultiLineStrings_ShouldLoadWithDefaultOptions()
+        {
+            EnsureNativeLibraryAvailable();
+            var rows = new[] { new PersonRow(1, "line one\nline two", null), new PersonRow(2, "crlf\r\nend", 2.0), new PersonRow(3, "plain", null) };
+
+            _connection!.CreateBulkLoader().Load("Person", rows);
+
+            using var result = _connection.Query("MATCH (p:Person) RETURN p.name ORDER BY p.id;");
+            var reader = result.GetReader();
+            Assert.IsTrue(reader.Read());
+            Assert.AreEqual("line one\nline two", reader.GetString(0));
+            Assert.IsTrue(reader.Read());
+            Assert.AreEqual("crlf\r\nend", reader.GetString(0));
+            Assert.IsTrue(reader.Read());
+            Assert.AreEqual("plain", reader.GetString(0));
+        }
+
+        [TestMethod]
+        public void Load_ShouldReportProgressPerBatch()
+        {
+            EnsureNativeLibraryAvailable();
+            var reports = new List<BulkLoadProgress>();
+            var progress = new SynchronousProgress(reports.Add);
+
+            _connection!.CreateBulkLoader(new BulkLoadOptions { BatchSize = 4 }).Load("Person", Enumerable.Range(0, 10).Select(i => new PersonRow(i, null, null)), progress);
+
+            CollectionAssert.AreEqual(new long[] { 4, 8, 10 }, reports.Select(r => r.RowsLoaded).ToArray());
+            Assert.AreEqual(3, reports[^1].BatchesCompleted);
+        }
+
+        [TestMethod]
+        public void Load_DataReader_ShouldCopyRows()
+        {
+            EnsureNativeLibraryAvailable();
+            using var table = new DataTable();
+            table.Columns.Add("id", typeof(long));
+            table.Columns.Add("name", typeof(string));
+            table.Columns.Add("score", typeof(double));
+            table.Rows.Add(1L, "a", 2.0);
+            table.Rows.Add(2L, DBNull.Value, DBNull.Value);
+
+            var result = _connection!.CreateBulkLoader().Load("Person", table.CreateDataReader());
+
+            Assert.AreEqual(2, result.RowsLoaded);
+            Assert.AreEqual(2, CountPeople());
+        }
+
+        [TestMethod]
+        public void Load_EmptySource_ShouldIssueNoCopy()
+        {
+            EnsureNativeLibraryAvailable();
+            var result = _connection!.CreateBulkLoader().Load("Person", Array.Empty<PersonRow>());
+            Assert.AreEqual(0, result.RowsLoaded);
+            Assert.AreEqual(0, result.Batches);
+        }
+
+        [TestMethod]
+        public void Load_DuplicateKey_ShouldThrowWithLoadedCount()
+        {
+            EnsureNativeLibraryAvailable();
+            var rows = new[] { new PersonRow(1, "a", null), new PersonRow(2, "b", null), new PersonRow(2, "c", null) };
+            var ex = Assert.ThrowsExactly<KuzuException>(() => _connection!.CreateBulkLoader(new BulkLoadOptions { BatchSize = 2 }).Load("Person", rows));
+            StringAssert.Contains(ex.Message, "after 2 rows");
+        }
+
+        [TestMethod]
+        public void Load_TimeSpan_ShouldRoundTripAsInterval()
+        {
+            EnsureNativeLibraryAvailable();
+            _connection!.Query("CREATE NODE TABLE Event(id INT64, duration INTERVAL, PRIMARY KEY(id));").Dispose();
+            var span = new TimeSpan(2, 3, 4, 5, 678) + TimeSpan.FromTicks(90);
+            var rows = new[] { new EventRow(1, span), new EventRow(2, null) };
+
+            _connection.CreateBulkLoader().Load("Event", rows);
+
+            using var result = _connection.Query("MATCH (e:Event) RETURN e.duration ORDER BY e.id;");
+            var reader = result.GetReader();
+            Assert.IsTrue(reader.Read());
+            Assert.AreEqual(span, reader.GetInterval(0));
+            Assert.IsTrue(reader.Read());
+            Assert.IsTrue(reader.IsNull(0));
+        }
+
+        [TestMethod]
+        public void Load_TypeMixingFieldsAndProperties_ShouldThrowNotSupported()
+        {
+            EnsureNativeLibraryAvailable();
+            var loader = _connection!.CreateBulkLoader();
+            Assert.ThrowsExactly<NotSupportedException>(() => loader.Load("Person", new[] { new MixedRow() }));
+        }
+
+        [TestMethod]
+        public void Load_TypeWithoutMembers_ShouldThrowNotSupportedEachTime()
+        {
+            EnsureNativeLibraryAvailable();
+            var loader = _connection!.CreateBulkLoader();
+            Assert.ThrowsExactly<NotSupportedException>(() => loader.Load("Person", new[] { new EmptyRow() }));
+            Assert.ThrowsExactly<NotSupportedException>(() => loader.Load("Person", new[] { new EmptyRow() }));
+        }
+
+        [TestMethod]
+        public void CreateBulkLoader_InvalidBatchSize_ShouldThrow()
+        {
+            EnsureNativeLibraryAvailable();
+            Assert.ThrowsExactly<ArgumentOutOfRangeException>(() => _connection!.CreateBulkLoader(new BulkLoadOptions { BatchSize = 0 }));
+        }
+
+        private sealed class SynchronousProgress : IProgress<BulkLoadProgress>
+        {
+            private readonly Action<BulkLoadProgress> _report;
+            public SynchronousProgress(Action<BulkLoadProgress> report) => _report = report;
+            public void Report(BulkLoadProgress value) => _report(value);
+        }
+    }
+}
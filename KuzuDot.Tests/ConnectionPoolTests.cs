@@ -0,0 +1,161 @@
+using System;
+using System.Threading.Tasks;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+
+namespace KuzuDot.Tests
+{
+    [TestClass]
+    public class ConnectionPoolTests
+    {
+        private Database? _database;
+        private string? _initializationError;
+
+        [TestInitialize]
+        public void TestInitialize()
+        {
+            try
+            {
+                _database = new Database(":memory:");
+                _initializationError = null;
+            }
+            catch (KuzuException ex)
+            {
+                _database = null;
+                _initializationError = ex.Message;
+            }
+        }
+
+        [TestCleanup]
+        public void TestCleanup()
+        {
+            _database?.Dispose();
+        }
+
+        private void EnsureNativeLibraryAvailable()
+        {
+            if (_database == null)
+            {
+                throw new InvalidOperationException($"Cannot run test: Native Kuzu library is not available. Error: {_initializationError}");
+            }
+        }
+
+        [TestMethod]
+        public void Rent_AfterReturn_ShouldReuseConnection()
+        {
+            EnsureNativeLibraryAvailable();
+            using var pool = _database!.CreateConnectionPool(new KuzuConnectionPoolOptions { MaxSize = 4 });
+
+            Connection first;
+            using (var lease = pool.Rent()) first = lease.Connection;
+            using (var lease = pool.Rent())
+            {
+                Assert.AreSame(first, lease.Connection);
+                Assert.AreEqual(1, pool.Count);
+                Assert.AreEqual(0, pool.IdleCount);
+            }
+            Assert.AreEqual(1, pool.IdleCount);
+        }
+
+        [TestMethod]
+        public void MinSize_ShouldPrewarmConnections()
+        {
+            EnsureNativeLibraryAvailable();
+            using var pool = _database!.CreateConnectionPool(new KuzuConnectionPoolOptions { MinSize = 2, MaxSize = 4 });
+
+            Assert.AreEqual(2, pool.Count);
+            Assert.AreEqual(2, pool.IdleCount);
+        }
+
+        [TestMethod]
+        public void Rent_ShouldApplyConnectionSettings()
+        {
+            EnsureNativeLibraryAvailable();
+            using var pool = _database!.CreateConnectionPool(new KuzuConnectionPoolOptions { MaxNumThreadsForExecution = 1 });
+            using var lease = pool.Rent();
+
+            Assert.AreEqual(1UL, lease.Connection.MaxNumThreadsForExecution);
+        }
+
+        [TestMethod]
+        public void Rent_WhenExhausted_ShouldTimeOut()
+        {
+            EnsureNativeLibraryAvailable();
+            using var pool = _database!.CreateConnectionPool(new KuzuConnectionPoolOptions { MaxSize = 1, AcquireTimeout = TimeSpan.FromMilliseconds(50) });
+            using var lease = pool.Rent();
+
+            Assert.ThrowsExactly<TimeoutException>(() => pool.Rent());
+        }
+
+        [TestMethod]
+        public async Task RentAsync_ShouldWaitForReturnedConnection()
+        {
+            EnsureNativeLibraryAvailable();
+            using var pool = _database!.CreateConnectionPool(new KuzuConnectionPoolOptions { MaxSize = 1 });
+            var lease = pool.Rent();
+
+            var pending = pool.RentAsync();
+            Assert.IsFalse(pending.IsCompleted);
+            lease.Dispose();
+
+            using var next = await pending;
+            Assert.AreEqual(1, pool.Count);
+        }
+
+        [TestMethod]
+        public void Lease_AfterDispose_ShouldThrow()
+        {
+            EnsureNativeLibraryAvailable();
+            using var pool = _database!.CreateConnectionPool();
+            var lease = pool.Rent();
+            lease.Dispose();
+            lease.Dispose();
+
+            Assert.ThrowsExactly<ObjectDisposedException>(() => lease.Connection);
+            Assert.AreEqual(1, pool.IdleCount);
+        }
+
+        [TestMethod]
+        public void Return_OfDisposedConnection_ShouldDropIt()
+        {
+            EnsureNativeLibraryAvailable();
+            using var pool = _database!.CreateConnectionPool(new KuzuConnectionPoolOptions { ValidateOnRent = true });
+            using (var lease = pool.Rent()) lease.Connection.Dispose();
+
+            Assert.AreEqual(0, pool.Count);
+            using var fresh = pool.Rent();
+            using var result = fresh.Connection.Query("RETURN 1;");
+            Assert.IsTrue(result.IsSuccess);
+        }
+
+        [TestMethod]
+        public void Return_MidTransaction_ShouldRollBackBeforeReuse()
+        {
+            EnsureNativeLibraryAvailable();
+            using var pool = _database!.CreateConnectionPool(new KuzuConnectionPoolOptions { MaxSize = 1 });
+            using (var setup = pool.Rent()) setup.Connection.Query("CREATE NODE TABLE Item(id INT64, PRIMARY KEY(id));").Dispose();
+
+            KuzuTransaction abandoned;
+            using (var lease = pool.Rent())
+            {
+                abandoned = lease.Connection.BeginTransaction();
+                lease.Connection.Query("CREATE (:Item {id: 1});").Dispose();
+            }
+
+            Assert.AreEqual(KuzuTransactionState.RolledBack, abandoned.State);
+            using var next = pool.Rent();
+            Assert.IsNull(next.Connection.CurrentTransaction);
+            using (var transaction = next.Connection.BeginTransaction()) transaction.Commit();
+            using var result = next.Connection.Query("MATCH (i:Item) RETURN count(i);");
+            var reader = result.GetReader();
+            Assert.IsTrue(reader.Read());
+            Assert.AreEqual(0L, reader.GetInt64(0));
+        }
+
+        [TestMethod]
+        public void Options_WithInvalidSizes_ShouldThrow()
+        {
+            EnsureNativeLibraryAvailable();
+            Assert.ThrowsExactly<ArgumentOutOfRangeException>(() => _database!.CreateConnectionPool(new KuzuConnectionPoolOptions { MinSize = 3, MaxSize = 2 }));
+        }
+    }
+}
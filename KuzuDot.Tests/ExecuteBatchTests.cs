@@ -0,0 +1,100 @@
+using System;
+using System.Linq;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+
+namespace KuzuDot.Tests
+{
+    [TestClass]
+    public class ExecuteBatchTests
+    {
+        private Database? _database;
+        private Connection? _connection;
+        private string? _initializationError;
+
+        [TestInitialize]
+        public void TestInitialize()
+        {
+            try
+            {
+                _database = new Database(":memory:");
+                _connection = _database.Connect();
+                _connection.Query("CREATE NODE TABLE Person(name STRING, age INT64, PRIMARY KEY(name));").Dispose();
+                _initializationError = null;
+            }
+            catch (KuzuException ex)
+            {
+                _database = null;
+                _connection = null;
+                _initializationError = ex.Message;
+            }
+        }
+
+        [TestCleanup]
+        public void TestCleanup()
+        {
+            _connection?.Dispose();
+            _database?.Dispose();
+        }
+
+        private void EnsureNativeLibraryAvailable()
+        {
+            if (_database == null || _connection == null)
+            {
+                throw new InvalidOperationException($"Cannot run test: Native Kuzu library is not available. Error: {_initializationError}");
+            }
+        }
+
+        [TestMethod]
+        public void ExecuteBatch_ShouldInsertEveryRow()
+        {
+            EnsureNativeLibraryAvailable();
+            using var stmt = _connection!.Prepare("CREATE (:Person {name: $name, age: $age});");
+
+            var outcome = stmt.ExecuteBatch(Enumerable.Range(0, 100), (b, i) =>
+            {
+                b.BindString("name", "p" + i);
+                b.BindInt64("age", i);
+            });
+
+            Assert.AreEqual(100L, outcome.Executions);
+            Assert.IsTrue(outcome.Elapsed > TimeSpan.Zero);
+            using var result = _connection.Query("MATCH (p:Person) RETURN count(*), sum(p.age);");
+            var reader = result.GetReader();
+            Assert.IsTrue(reader.Read());
+            Assert.AreEqual(100L, reader.GetInt64(0));
+            Assert.AreEqual(4950L, reader.GetInt64(1));
+        }
+
+        [TestMethod]
+        public void ExecuteBatch_ShouldAggregateReturnedTuples()
+        {
+            EnsureNativeLibraryAvailable();
+            using var stmt = _connection!.Prepare("UNWIND range(1, $n) AS x RETURN x;");
+
+            var outcome = stmt.ExecuteBatch(new[] { 1L, 2L, 3L }, (b, n) => b.BindInt64("n", n));
+
+            Assert.AreEqual(3L, outcome.Executions);
+            Assert.AreEqual(6UL, outcome.TuplesReturned);
+        }
+
+        [TestMethod]
+        public void ExecuteBatch_WithFailingRow_ShouldReportRowIndex()
+        {
+            EnsureNativeLibraryAvailable();
+            using var stmt = _connection!.Prepare("CREATE (:Person {name: $name, age: 1});");
+
+            var ex = Assert.ThrowsExactly<KuzuException>(() => stmt.ExecuteBatch(new[] { "a", "b", "a" }, (b, name) => b.BindString("name", name)));
+
+            StringAssert.Contains(ex.Message, "row 2");
+        }
+
+        [TestMethod]
+        public void ExecuteBatch_WithUnknownParameter_ShouldThrow()
+        {
+            EnsureNativeLibraryAvailable();
+            using var stmt = _connection!.Prepare("CREATE (:Person {name: $name, age: 1});");
+
+            Assert.ThrowsExactly<KuzuException>(() => stmt.ExecuteBatch(new[] { 1 }, (b, i) => b.BindInt64("missing", i)));
+        }
+    }
+}
@@ -0,0 +1,122 @@
+using System;
+using System.Linq;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+
+namespace KuzuDot.Tests
+{
+    [TestClass]
+    public class GraphProjectionTests
+    {
+        private Database? _database;
+        private Connection? _connection;
+        private string? _initializationError;
+
+        [TestInitialize]
+        public void TestInitialize()
+        {
+            try
+            {
+                _database = new Database(":memory:");
+                _connection = _database.Connect();
+                _connection.Query("CREATE NODE TABLE Person(id INT64, PRIMARY KEY(id));").Dispose();
+                _connection.Query("CREATE REL TABLE Knows(FROM Person TO Person);").Dispose();
+                _connection.Query("UNWIND range(0, 4) AS i CREATE (:Person {id: i});").Dispose();
+                // 0->1, 0->2, 1->2, 2->3, 3->4
+                _connection.Query("UNWIND [[0,1],[0,2],[1,2],[2,3],[3,4]] AS e MATCH (a:Person {id: e[1]}), (b:Person {id: e[2]}) CREATE (a)-[:Knows]->(b);").Dispose();
+                _initializationError = null;
+            }
+            catch (KuzuException ex)
+            {
+                _database = null;
+                _connection = null;
+                _initializationError = ex.Message;
+            }
+        }
+
+        [TestCleanup]
+        public void TestCleanup()
+        {
+            _connection?.Dispose();
+            _database?.Dispose();
+        }
+
+        private void EnsureNativeLibraryAvailable()
+        {
+            if (_database == null || _connection == null)
+            {
+                throw new InvalidOperationException($"Cannot run test: Native Kuzu library is not available. Error: {_initializationError}");
+            }
+        }
+
+        private long PersonKey(GraphProjection graph, int vertex)
+        {
+            var id = graph.GetVertexId(vertex);
+            using var result = _connection!.Query($"MATCH (p:Person) WHERE offset(ID(p)) = {id.Offset} RETURN p.id;");
+            var reader = result.GetReader();
+            Assert.IsTrue(reader.Read());
+            return reader.GetInt64(0);
+        }
+
+        [TestMethod]
+        public void ProjectGraph_InternalIds_ShouldBuildCsr()
+        {
+            EnsureNativeLibraryAvailable();
+            var graph = _connection!.ProjectGraph(
+                "MATCH (p:Person) RETURN ID(p) ORDER BY p.id;",
+                "MATCH (a:Person)-[:Knows]->(b:Person) RETURN ID(a), ID(b);");
+
+            Assert.AreEqual(5, graph.VertexCount);
+            Assert.AreEqual(5, graph.EdgeCount);
+            Assert.AreEqual(6, graph.Offsets.Length);
+            Assert.AreEqual(2, graph.GetOutDegree(0));
+            Assert.AreEqual(0, graph.GetOutDegree(4));
+            CollectionAssert.AreEquivalent(new[] { 1L, 2L }, graph.GetNeighbors(0).ToArray().Select(v => PersonKey(graph, v)).ToArray());
+        }
+
+        [TestMethod]
+        public void ProjectGraph_NodeColumns_AndUndirected_ShouldStoreBothDirections()
+        {
+            EnsureNativeLibraryAvailable();
+            var graph = _connection!.ProjectGraph("MATCH (p:Person) RETURN p;", "MATCH (a:Person)-[:Knows]->(b:Person) RETURN a, b;", directed: false);
+
+            Assert.IsFalse(graph.IsDirected);
+            Assert.AreEqual(10, graph.EdgeCount);
+            var degrees = Enumerable.Range(0, graph.VertexCount).Sum(v => graph.GetOutDegree(v));
+            Assert.AreEqual(10, degrees);
+        }
+
+        [TestMethod]
+        public void ProjectGraph_EdgesOutsideVertexSet_ShouldBeSkipped()
+        {
+            EnsureNativeLibraryAvailable();
+            var graph = _connection!.ProjectGraph(
+                "MATCH (p:Person) WHERE p.id < 3 RETURN ID(p);",
+                "MATCH (a:Person)-[:Knows]->(b:Person) RETURN ID(a), ID(b);");
+
+            Assert.AreEqual(3, graph.VertexCount);
+            Assert.AreEqual(3, graph.EdgeCount);
+            Assert.AreEqual(2, graph.SkippedEdges);
+        }
+
+        [TestMethod]
+        public void TryGetVertex_ShouldRoundTripIds()
+        {
+            EnsureNativeLibraryAvailable();
+            var graph = _connection!.ProjectGraph("MATCH (p:Person) RETURN ID(p);", "MATCH (a:Person)-[:Knows]->(b:Person) RETURN ID(a), ID(b);");
+
+            for (int v = 0; v < graph.VertexCount; v++)
+            {
+                Assert.IsTrue(graph.TryGetVertex(graph.GetVertexId(v), out var back));
+                Assert.AreEqual(v, back);
+            }
+            Assert.IsFalse(graph.TryGetVertex(new InternalId(999, 0), out _));
+        }
+
+        [TestMethod]
+        public void ProjectGraph_ScalarColumn_ShouldThrow()
+        {
+            EnsureNativeLibraryAvailable();
+            Assert.ThrowsExactly<KuzuException>(() => _connection!.ProjectGraph("MATCH (p:Person) RETURN p.id;", "MATCH (a:Person)-[:Knows]->(b:Person) RETURN ID(a), ID(b);"));
+        }
+    }
+}
@@ -0,0 +1,161 @@
+using System;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+
+namespace KuzuDot.Tests
+{
+    [TestClass]
+    public class KuzuDataReaderTests
+    {
+        private Database? _database;
+        private Connection? _connection;
+        private string? _initializationError;
+
+        [TestInitialize]
+        public void TestInitialize()
+        {
+            try
+            {
+                _database = new Database(":memory:");
+                _connection = _database.Connect();
+                _connection.Query("CREATE NODE TABLE Person(name STRING, age INT64, score DOUBLE, PRIMARY KEY(name));").Dispose();
+                _connection.Query("CREATE (:Person {name: 'Alice', age: 30, score: 1.5});").Dispose();
+                _connection.Query("CREATE (:Person {name: 'Bob', age: 25});").Dispose();
+                _initializationError = null;
+            }
+            catch (KuzuException ex)
+            {
+                _database = null;
+                _connection = null;
+                _initializationError = ex.Message;
+            }
+        }
+
+        [TestCleanup]
+        public void TestCleanup()
+        {
+            _connection?.Dispose();
+            _database?.Dispose();
+        }
+
+        private void EnsureNativeLibraryAvailable()
+        {
+            if (_database == null || _connection == null)
+            {
+                throw new InvalidOperationException($"Cannot run test: Native Kuzu library is not available. Error: {_initializationError}");
+            }
+        }
+
+        [TestMethod]
+        public void Read_ShouldIterateAllRows()
+        {
+            EnsureNativeLibraryAvailable();
+            using var result = _connection!.Query("MATCH (p:Person) RETURN p.name, p.age ORDER BY p.name;");
+            var reader = result.GetReader();
+
+            Assert.AreEqual(2, reader.FieldCount);
+            int rows = 0;
+            while (reader.Read()) rows++;
+
+            Assert.AreEqual(2, rows);
+            Assert.IsFalse(reader.Read());
+        }
+
+        [TestMethod]
+        public void Schema_ShouldExposeNamesAndTypes()
+        {
+            EnsureNativeLibraryAvailable();
+            using var result = _connection!.Query("MATCH (p:Person) RETURN p.name, p.age;");
+            var reader = result.GetReader();
+
+            Assert.AreEqual("p.name", reader.GetName(0));
+            Assert.AreEqual(1, reader.GetOrdinal("p.age"));
+            Assert.AreEqual(-1, reader.GetOrdinal("missing"));
+            Assert.AreEqual(typeof(string), reader.GetFieldType(0));
+            Assert.AreEqual(typeof(long), reader.GetFieldType(1));
+        }
+
+        [TestMethod]
+        public void IsNull_ShouldReflectMissingProperty()
+        {
+            EnsureNativeLibraryAvailable();
+            using var result = _connection!.Query("MATCH (p:Person) RETURN p.score ORDER BY p.name;");
+            var reader = result.GetReader();
+
+            Assert.IsTrue(reader.Read());
+            Assert.IsFalse(reader.IsNull(0));
+            Assert.IsTrue(reader.Read());
+            Assert.IsTrue(reader.IsNull(0));
+        }
+
+        [TestMethod]
+        public void GetValue_BeforeRead_ShouldThrow()
+        {
+            EnsureNativeLibraryAvailable();
+            using var result = _connection!.Query("MATCH (p:Person) RETURN p.name;");
+            var reader = result.GetReader();
+
+            Assert.ThrowsExactly<InvalidOperationException>(() => reader.IsNull(0));
+        }
+
+        [TestMethod]
+        public void GetValue_WithInvalidOrdinal_ShouldThrow()
+        {
+            EnsureNativeLibraryAvailable();
+            using var result = _connection!.Query("MATCH (p:Person) RETURN p.name;");
+            var reader = result.GetReader();
+            Assert.IsTrue(reader.Read());
+
+            Assert.ThrowsExactly<ArgumentOutOfRangeException>(() => reader.IsNull(5));
+        }
+
+        [TestMethod]
+        public void Read_AfterResultDisposed_ShouldThrow()
+        {
+            EnsureNativeLibraryAvailable();
+            var result = _connection!.Query("MATCH (p:Person) RETURN p.name;");
+            var reader = result.GetReader();
+            result.Dispose();
+
+            Assert.ThrowsExactly<ObjectDisposedException>(() => reader.Read());
+        }
+
+        [TestMethod]
+        public void TypedAccessors_ShouldReadPrimitiveColumns()
+        {
+            EnsureNativeLibraryAvailable();
+            using var result = _connection!.Query("MATCH (p:Person) WHERE p.name = 'Alice' RETURN p.name, p.age, p.score;");
+            var reader = result.GetReader();
+            Assert.IsTrue(reader.Read());
+
+            Assert.AreEqual("Alice", reader.GetString(0));
+            Assert.AreEqual(30L, reader.GetInt64(1));
+            Assert.AreEqual(1.5, reader.GetDouble(2), 1e-9);
+        }
+
+        [TestMethod]
+        public void TypedAccessors_ShouldReadTemporalAndIdColumns()
+        {
+            EnsureNativeLibraryAvailable();
+            using var result = _connection!.Query("MATCH (p:Person) WHERE p.name = 'Alice' RETURN id(p), date('2024-01-15'), timestamp('2024-01-15 10:30:00'), interval('2 days');");
+            var reader = result.GetReader();
+            Assert.IsTrue(reader.Read());
+
+            Assert.AreEqual(typeof(InternalId), reader.GetFieldType(0));
+            _ = reader.GetInternalId(0);
+            Assert.AreEqual(new DateTime(2024, 1, 15, 0, 0, 0, DateTimeKind.Utc), reader.GetDateTime(1));
+            Assert.AreEqual(new DateTime(2024, 1, 15, 10, 30, 0, DateTimeKind.Utc), reader.GetDateTime(2));
+            Assert.AreEqual(TimeSpan.FromDays(2), reader.GetInterval(3));
+        }
+
+        [TestMethod]
+        public void TypedAccessor_WithMismatchedType_ShouldThrowKuzuException()
+        {
+            EnsureNativeLibraryAvailable();
+            using var result = _connection!.Query("MATCH (p:Person) RETURN p.name;");
+            var reader = result.GetReader();
+            Assert.IsTrue(reader.Read());
+
+            Assert.ThrowsExactly<KuzuException>(() => reader.GetInt64(0));
+        }
+    }
+}
@@ -0,0 +1,161 @@
+using System;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+
+namespace KuzuDot.Tests
+{
+    [TestClass]
+    public class NodeCacheTests
+    {
+        private Database? _database;
+        private Connection? _connection;
+        private string? _initializationError;
+
+        [TestInitialize]
+        public void TestInitialize()
+        {
+            try
+            {
+                _database = new Database(":memory:");
+                _connection = _database.Connect();
+                _connection.Query("CREATE NODE TABLE Person(id INT64, name STRING, PRIMARY KEY(id));").Dispose();
+                _connection.Query("CREATE (:Person {id: 1, name: 'a'}), (:Person {id: 2, name: 'b'}), (:Person {id: 3, name: 'c'});").Dispose();
+                _initializationError = null;
+            }
+            catch (KuzuException ex)
+            {
+                _database = null;
+                _connection = null;
+                _initializationError = ex.Message;
+            }
+        }
+
+        [TestCleanup]
+        public void TestCleanup()
+        {
+            _connection?.Dispose();
+            _database?.Dispose();
+        }
+
+        private void EnsureNativeLibraryAvailable()
+        {
+            if (_database == null || _connection == null)
+            {
+                throw new InvalidOperationException($"Cannot run test: Native Kuzu library is not available. Error: {_initializationError}");
+            }
+        }
+
+        private InternalId IdOf(long id)
+        {
+            using var result = _connection!.Query($"MATCH (p:Person) WHERE p.id = {id} RETURN ID(p);");
+            var reader = result.GetReader();
+            Assert.IsTrue(reader.Read());
+            return reader.GetInternalId(0);
+        }
+
+        [TestMethod]
+        public void GetOrLoad_SecondCall_ShouldHitCache()
+        {
+            EnsureNativeLibraryAvailable();
+            _connection!.EnableNodeCache();
+            var cache = _connection.NodeCache!;
+            var id = IdOf(1);
+
+            var first = cache.GetOrLoad(id);
+            var second = cache.GetOrLoad(id);
+            Assert.AreEqual("a", first["name"]);
+            Assert.AreEqual(id, second.Id);
+            Assert.AreEqual(1, cache.Count);
+            Assert.AreEqual(1L, cache.Hits);
+            Assert.AreEqual(1L, cache.Misses);
+        }
+
+        [TestMethod]
+        public void WriteOnAnotherConnection_ShouldInvalidateEntries()
+        {
+            EnsureNativeLibraryAvailable();
+            _connection!.EnableNodeCache();
+            var cache = _connection.NodeCache!;
+            var id = IdOf(1);
+            Assert.AreEqual("a", cache.GetOrLoad(id)["name"]);
+
+            var generation = _database!.WriteGeneration;
+            using (var other = _database.Connect())
+            {
+                other.Query("MATCH (p:Person {id: 1}) SET p.name = 'z';").Dispose();
+            }
+            Assert.IsTrue(_database.WriteGeneration > generation);
+
+            Assert.IsFalse(cache.TryGet(id, out _));
+            Assert.AreEqual(1L, cache.Invalidations);
+            Assert.AreEqual("z", cache.GetOrLoad(id)["name"]);
+        }
+
+        [TestMethod]
+        public void ReadQueries_ShouldNotBumpWriteGeneration()
+        {
+            EnsureNativeLibraryAvailable();
+            var generation = _database!.WriteGeneration;
+            _connection!.Query("MATCH (p:Person) RETURN p.name;").Dispose();
+            using (var statement = _connection.Prepare("MATCH (p:Person) WHERE p.id = $id RETURN p;"))
+            {
+                statement.Bind("id", 1L);
+                statement.Execute().Dispose();
+            }
+            Assert.AreEqual(generation, _database.WriteGeneration);
+        }
+
+        [TestMethod]
+        public void Capacity_ShouldEvictLeastRecentlyUsed()
+        {
+            EnsureNativeLibraryAvailable();
+            _connection!.EnableNodeCache(new NodeCacheOptions { Capacity = 2, ShardCount = 1 });
+            var cache = _connection.NodeCache!;
+            var a = IdOf(1);
+            var b = IdOf(2);
+            var c = IdOf(3);
+
+            cache.GetOrLoad(a);
+            cache.GetOrLoad(b);
+            cache.GetOrLoad(a);
+            cache.GetOrLoad(c);
+
+            Assert.AreEqual(2, cache.Count);
+            Assert.AreEqual(1L, cache.Evictions);
+            Assert.IsTrue(cache.TryGet(a, out _));
+            Assert.IsFalse(cache.TryGet(b, out _));
+        }
+
+        [TestMethod]
+        public void TryGetOrLoad_UnknownId_ShouldReturnFalse()
+        {
+            EnsureNativeLibraryAvailable();
+            _connection!.EnableNodeCache();
+            var missing = new InternalId(IdOf(1).TableId, 1_000_000);
+            Assert.IsFalse(_connection.NodeCache!.TryGetOrLoad(missing, out _));
+            Assert.ThrowsExactly<System.Collections.Generic.KeyNotFoundException>(() => _connection.NodeCache.GetOrLoad(missing));
+        }
+
+        [TestMethod]
+        public void GetOrLoad_AfterDisable_ShouldThrowObjectDisposed()
+        {
+            EnsureNativeLibraryAvailable();
+            _connection!.EnableNodeCache();
+            var cache = _connection.NodeCache!;
+            var id = IdOf(1);
+            cache.GetOrLoad(id);
+
+            _connection.DisableNodeCache();
+
+            Assert.IsFalse(cache.TryGet(id, out _));
+            Assert.ThrowsExactly<ObjectDisposedException>(() => cache.GetOrLoad(id));
+        }
+
+        [TestMethod]
+        public void EnableNodeCache_InvalidOptions_ShouldThrow()
+        {
+            EnsureNativeLibraryAvailable();
+            Assert.ThrowsExactly<ArgumentOutOfRangeException>(() => _connection!.EnableNodeCache(new NodeCacheOptions { Capacity = 0 }));
+            Assert.IsNull(_connection!.NodeCache);
+        }
+    }
+}
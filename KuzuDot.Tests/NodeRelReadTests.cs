@@ -0,0 +1,124 @@
+using System;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+
+namespace KuzuDot.Tests
+{
+    [TestClass]
+    public class NodeRelReadTests
+    {
+        private Database? _database;
+        private Connection? _connection;
+        private string? _initializationError;
+
+        [TestInitialize]
+        public void TestInitialize()
+        {
+            try
+            {
+                _database = new Database(":memory:");
+                _connection = _database.Connect();
+                _connection.Query("CREATE NODE TABLE Person(id INT64, name STRING, score DOUBLE, PRIMARY KEY(id));").Dispose();
+                _connection.Query("CREATE REL TABLE Knows(FROM Person TO Person, since INT32);").Dispose();
+                _connection.Query("CREATE (:Person {id: 1, name: 'a', score: 1.5}), (:Person {id: 2, name: 'b'});").Dispose();
+                _connection.Query("MATCH (a:Person {id: 1}), (b:Person {id: 2}) CREATE (a)-[:Knows {since: 2020}]->(b);").Dispose();
+                _initializationError = null;
+            }
+            catch (KuzuException ex)
+            {
+                _database = null;
+                _connection = null;
+                _initializationError = ex.Message;
+            }
+        }
+
+        [TestCleanup]
+        public void TestCleanup()
+        {
+            _connection?.Dispose();
+            _database?.Dispose();
+        }
+
+        private void EnsureNativeLibraryAvailable()
+        {
+            if (_database == null || _connection == null)
+            {
+                throw new InvalidOperationException($"Cannot run test: Native Kuzu library is not available. Error: {_initializationError}");
+            }
+        }
+
+        [TestMethod]
+        public void ReaderReadNode_ShouldDecodeLabelAndTypedProperties()
+        {
+            EnsureNativeLibraryAvailable();
+            using var result = _connection!.Query("MATCH (p:Person) RETURN p ORDER BY p.id;");
+            var reader = result.GetReader();
+
+            Assert.IsTrue(reader.Read());
+            var first = reader.ReadNode(0);
+            Assert.AreEqual("Person", first.Label);
+            Assert.AreEqual(1L, first["id"]);
+            Assert.AreEqual("a", first.GetProperty<string>("name"));
+            Assert.AreEqual(1.5, first["score"]);
+
+            Assert.IsTrue(reader.Read());
+            var second = reader.ReadNode(0);
+            Assert.IsNull(second["score"]);
+            Assert.AreNotEqual(first.Id, second.Id);
+        }
+
+        [TestMethod]
+        public void ReadNode_SameLabel_ShouldShareInternedNames()
+        {
+            EnsureNativeLibraryAvailable();
+            using var result = _connection!.Query("MATCH (p:Person) RETURN p ORDER BY p.id;");
+            var reader = result.GetReader();
+            Assert.IsTrue(reader.Read());
+            var first = reader.ReadNode(0);
+            Assert.IsTrue(reader.Read());
+            var second = reader.ReadNode(0);
+
+            Assert.AreSame(first.PropertyNames, second.PropertyNames);
+            Assert.AreSame(first.Label, second.Label);
+        }
+
+        [TestMethod]
+        public void ReaderReadRel_ShouldDecodeEndpointsAndProperties()
+        {
+            EnsureNativeLibraryAvailable();
+            using var result = _connection!.Query("MATCH (a:Person)-[k:Knows]->(b:Person) RETURN a, k, b;");
+            var reader = result.GetReader();
+            Assert.IsTrue(reader.Read());
+
+            var rel = reader.ReadRel(1);
+            Assert.AreEqual("Knows", rel.Label);
+            Assert.AreEqual(2020, rel["since"]);
+            Assert.AreEqual(reader.ReadNode(0).Id, rel.SourceId);
+            Assert.AreEqual(reader.ReadNode(2).Id, rel.DestinationId);
+        }
+
+        [TestMethod]
+        public void KuzuValueReadNode_FromFlatTuple_ShouldMatchReader()
+        {
+            EnsureNativeLibraryAvailable();
+            using var result = _connection!.Query("MATCH (p:Person) WHERE p.id = 1 RETURN p;");
+            using var tuple = result.GetNext();
+            using var value = tuple.GetValue(0);
+
+            var node = value.ReadNode();
+            Assert.AreEqual("a", node["name"]);
+            Assert.IsTrue(node.TryGetProperty("score", out var score));
+            Assert.AreEqual(1.5, score);
+            Assert.IsFalse(node.TryGetProperty("missing", out _));
+        }
+
+        [TestMethod]
+        public void ReadNode_OnScalarColumn_ShouldThrow()
+        {
+            EnsureNativeLibraryAvailable();
+            using var result = _connection!.Query("RETURN 1;");
+            var reader = result.GetReader();
+            Assert.IsTrue(reader.Read());
+            Assert.ThrowsExactly<KuzuException>(() => reader.ReadNode(0));
+        }
+    }
+}
@@ -0,0 +1,115 @@
+using System;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+
+namespace KuzuDot.Tests
+{
+    [TestClass]
+    public class NodeViewTests
+    {
+        private Database? _database;
+        private Connection? _connection;
+        private string? _initializationError;
+
+        [TestInitialize]
+        public void TestInitialize()
+        {
+            try
+            {
+                _database = new Database(":memory:");
+                _connection = _database.Connect();
+                _connection.Query("CREATE NODE TABLE Person(id INT64, name STRING, score DOUBLE, PRIMARY KEY(id));").Dispose();
+                _connection.Query("CREATE REL TABLE Knows(FROM Person TO Person, since INT32);").Dispose();
+                _connection.Query("CREATE (:Person {id: 1, name: 'a', score: 1.5}), (:Person {id: 2, name: 'b'});").Dispose();
+                _connection.Query("MATCH (a:Person {id: 1}), (b:Person {id: 2}) CREATE (a)-[:Knows {since: 2020}]->(b);").Dispose();
+                _initializationError = null;
+            }
+            catch (KuzuException ex)
+            {
+                _database = null;
+                _connection = null;
+                _initializationError = ex.Message;
+            }
+        }
+
+        [TestCleanup]
+        public void TestCleanup()
+        {
+            _connection?.Dispose();
+            _database?.Dispose();
+        }
+
+        private void EnsureNativeLibraryAvailable()
+        {
+            if (_database == null || _connection == null)
+            {
+                throw new InvalidOperationException($"Cannot run test: Native Kuzu library is not available. Error: {_initializationError}");
+            }
+        }
+
+        [TestMethod]
+        public void NodeView_ShouldDecodeAccessedPropertiesOnDemand()
+        {
+            EnsureNativeLibraryAvailable();
+            using var result = _connection!.Query("MATCH (p:Person) RETURN p ORDER BY p.id;");
+            var reader = result.GetReader();
+
+            Assert.IsTrue(reader.Read());
+            var view = reader.GetNodeView(0);
+            Assert.AreEqual("Person", view.Label);
+            Assert.AreEqual(3, view.PropertyCount);
+            Assert.AreEqual("a", view["name"]);
+            Assert.AreEqual(1.5, view.GetProperty<double>("score"));
+            Assert.AreEqual(reader.ReadNode(0).Id, view.Id);
+
+            Assert.IsTrue(reader.Read());
+            var second = reader.GetNodeView(0);
+            Assert.IsNull(second["score"]);
+            Assert.IsFalse(second.TryGetProperty("missing", out _));
+            Assert.AreSame(view.PropertyNames, second.PropertyNames);
+        }
+
+        [TestMethod]
+        public void NodeView_AfterReaderAdvances_ShouldThrow()
+        {
+            EnsureNativeLibraryAvailable();
+            using var result = _connection!.Query("MATCH (p:Person) RETURN p ORDER BY p.id;");
+            var reader = result.GetReader();
+            Assert.IsTrue(reader.Read());
+            var view = reader.GetNodeView(0);
+            var kept = view.ToNode();
+            Assert.IsTrue(view.IsCurrent);
+
+            Assert.IsTrue(reader.Read());
+            Assert.IsFalse(view.IsCurrent);
+            Assert.AreEqual("Person", view.Label);
+            Assert.ThrowsExactly<InvalidOperationException>(() => view["name"]);
+            Assert.AreEqual("a", kept["name"]);
+        }
+
+        [TestMethod]
+        public void RelView_ShouldDecodeEndpointsAndProperties()
+        {
+            EnsureNativeLibraryAvailable();
+            using var result = _connection!.Query("MATCH (a:Person)-[k:Knows]->(b:Person) RETURN a, k, b;");
+            var reader = result.GetReader();
+            Assert.IsTrue(reader.Read());
+
+            var view = reader.GetRelView(1);
+            Assert.AreEqual("Knows", view.Label);
+            Assert.AreEqual(2020, view["since"]);
+            Assert.AreEqual(reader.ReadNode(0).Id, view.SourceId);
+            Assert.AreEqual(reader.ReadNode(2).Id, view.DestinationId);
+            Assert.AreEqual(view.Id, view.ToRel().Id);
+        }
+
+        [TestMethod]
+        public void GetNodeView_OnScalarColumn_ShouldThrow()
+        {
+            EnsureNativeLibraryAvailable();
+            using var result = _connection!.Query("RETURN 1;");
+            var reader = result.GetReader();
+            Assert.IsTrue(reader.Read());
+            Assert.ThrowsExactly<KuzuException>(() => reader.GetNodeView(0));
+        }
+    }
+}
@@ -0,0 +1,165 @@
+using System;
+using System.Linq;
+using System.Threading;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+
+namespace KuzuDot.Tests
+{
+    [TestClass]
+    public class ParallelIngestorTests
+    {
+        private Database? _database;
+        private Connection? _connection;
+        private string? _initializationError;
+
+        private sealed record PersonRow(long Id, string Name);
+
+        [TestInitialize]
+        public void TestInitialize()
+        {
+            try
+            {
+                _database = new Database(":memory:");
+                _connection = _database.Connect();
+                _connection.Query("CREATE NODE TABLE Person(id INT64, name STRING, PRIMARY KEY(id));").Dispose();
+                _initializationError = null;
+            }
+            catch (KuzuException ex)
+            {
+                _database = null;
+                _connection = null;
+                _initializationError = ex.Message;
+            }
+        }
+
+        [TestCleanup]
+        public void TestCleanup()
+        {
+            _connection?.Dispose();
+            _database?.Dispose();
+        }
+
+        private void EnsureNativeLibraryAvailable()
+        {
+            if (_database == null || _connection == null)
+            {
+                throw new InvalidOperationException($"Cannot run test: Native Kuzu library is not available. Error: {_initializationError}");
+            }
+        }
+
+        private long CountPeople()
+        {
+            using var result = _connection!.Query("MATCH (p:Person) RETURN count(p);");
+            var reader = result.GetReader();
+            Assert.IsTrue(reader.Read());
+            return reader.GetInt64(0);
+        }
+
+        [TestMethod]
+        public void Ingest_BindDelegate_ShouldWriteEveryRowOnce()
+        {
+            EnsureNativeLibraryAvailable();
+            var ingestor = _database!.CreateParallelIngestor(new ParallelIngestOptions { DegreeOfParallelism = 4, BatchSize = 50 });
+
+            var result = ingestor.Ingest("CREATE (:Person {id: $id, name: $name});", Enumerable.Range(0, 1000), (b, i) =>
+            {
+                b.BindInt64("id", i);
+                b.BindString("name", "p" + i);
+            });
+
+            Assert.AreEqual(1000, result.RowsIngested);
+            Assert.AreEqual(4, result.Workers);
+            Assert.IsTrue(result.Batches >= 20);
+            Assert.AreEqual(1000, CountPeople());
+        }
+
+        [TestMethod]
+        public void Ingest_ParameterObjects_WithPartitionKey_ShouldMergeInOrderPerKey()
+        {
+            EnsureNativeLibraryAvailable();
+            var rows = Enumerable.Range(0, 400).Select(i => new PersonRow(i % 40, "v" + i));
+            var ingestor = _database!.CreateParallelIngestor(new ParallelIngestOptions { DegreeOfParallelism = 3, BatchSize = 16 });
+
+            var result = ingestor.Ingest("MERGE (p:Person {id: $Id}) SET p.name = $Name;", rows, r => r.Id);
+
+            Assert.AreEqual(400, result.RowsIngested);
+            Assert.AreEqual(40, CountPeople());
+            using var names = _connection!.Query("MATCH (p:Person) WHERE p.id = 7 RETURN p.name;");
+            var reader = names.GetReader();
+            Assert.IsTrue(reader.Read());
+            Assert.AreEqual("v367", reader.GetString(0));
+        }
+
+        [TestMethod]
+        public void Ingest_TransientFailure_ShouldRetryThenFailWithCommittedCount()
+        {
+            EnsureNativeLibraryAvailable();
+            _connection!.Query("CREATE (:Person {id: 99, name: 'taken'});").Dispose();
+            var options = new ParallelIngestOptions { DegreeOfParallelism = 1, BatchSize = 2, MaxRetries = 2, RetryDelay = TimeSpan.Zero, IsTransient = _ => true };
+
+            var ex = Assert.ThrowsExactly<KuzuException>(() => _database!.CreateParallelIngestor(options)
+                .Ingest("CREATE (:Person {id: $Id, name: $Name});", new[] { new PersonRow(1, "a"), new PersonRow(2, "b"), new PersonRow(99, "dup") }));
+
+            StringAssert.Contains(ex.Message, "after 2 committed rows");
+            Assert.AreEqual(3, CountPeople());
+        }
+
+        [TestMethod]
+        public void Ingest_Cancelled_ShouldThrowOperationCanceled()
+        {
+            EnsureNativeLibraryAvailable();
+            using var cts = new CancellationTokenSource();
+            cts.Cancel();
+            Assert.ThrowsExactly<OperationCanceledException>(() => _database!.CreateParallelIngestor()
+                .Ingest("CREATE (:Person {id: $Id, name: $Name});", new[] { new PersonRow(1, "a") }, cancellationToken: cts.Token));
+        }
+
+        [TestMethod]
+        public void IsWriteConflict_ShouldMatchConflictMessages()
+        {
+            Assert.IsTrue(ParallelIngestor.IsWriteConflict(new KuzuException("Write-write conflict of updating the same node")));
+            Assert.IsFalse(ParallelIngestor.IsWriteConflict(new KuzuException("Found duplicated primary key value 1")));
+            Assert.IsFalse(ParallelIngestor.IsWriteConflict(new KuzuException("Cannot start a new write transaction in the system. Only one write transaction at a time is allowed in the system.")));
+            Assert.IsTrue(ParallelIngestor.IsWriteTransactionBusy(new KuzuException("Cannot start a new write transaction in the system. Only one write transaction at a time is allowed in the system.")));
+        }
+
+        [TestMethod]
+        public void Ingest_WhileAnotherWriterHoldsTransaction_ShouldWaitWithoutSpendingRetries()
+        {
+            EnsureNativeLibraryAvailable();
+            var options = new ParallelIngestOptions { DegreeOfParallelism = 2, BatchSize = 5, MaxRetries = 0, RetryDelay = TimeSpan.FromMilliseconds(1) };
+            var transaction = _connection!.BeginTransaction();
+            _connection.Query("CREATE (:Person {id: 1000, name: 'holder'});").Dispose();
+            using var release = new Timer(_ => transaction.Commit(), null, 200, Timeout.Infinite);
+
+            var result = _database!.CreateParallelIngestor(options)
+                .Ingest("CREATE (:Person {id: $Id, name: $Name});", Enumerable.Range(0, 40).Select(i => new PersonRow(i, "p" + i)));
+
+            Assert.AreEqual(40, result.RowsIngested);
+            Assert.AreEqual(0, result.Retries);
+            Assert.IsTrue(result.WriteTransactionWaits > 0);
+            Assert.AreEqual(41, CountPeople());
+        }
+
+        [TestMethod]
+        public void Ingest_WriteTransactionTimeout_ShouldFail()
+        {
+            EnsureNativeLibraryAvailable();
+            var options = new ParallelIngestOptions { DegreeOfParallelism = 1, WriteTransactionTimeout = TimeSpan.FromMilliseconds(100), RetryDelay = TimeSpan.FromMilliseconds(1) };
+            using var transaction = _connection!.BeginTransaction();
+
+            var ex = Assert.ThrowsExactly<KuzuException>(() => _database!.CreateParallelIngestor(options)
+                .Ingest("CREATE (:Person {id: $Id, name: $Name});", new[] { new PersonRow(1, "a") }));
+
+            StringAssert.Contains(ex.Message, "after 0 committed rows");
+        }
+
+        [TestMethod]
+        public void CreateParallelIngestor_InvalidOptions_ShouldThrow()
+        {
+            EnsureNativeLibraryAvailable();
+            Assert.ThrowsExactly<ArgumentOutOfRangeException>(() => _database!.CreateParallelIngestor(new ParallelIngestOptions { DegreeOfParallelism = 0 }));
+            Assert.ThrowsExactly<ArgumentOutOfRangeException>(() => _database!.CreateParallelIngestor(new ParallelIngestOptions { WriteTransactionTimeout = TimeSpan.FromSeconds(-1) }));
+        }
+    }
+}
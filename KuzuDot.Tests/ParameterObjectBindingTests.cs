@@ -0,0 +1,124 @@
+using System;
+using System.Collections.Generic;
+using System.Threading.Tasks;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+
+namespace KuzuDot.Tests
+{
+    [TestClass]
+    public class ParameterObjectBindingTests
+    {
+        private Database? _database;
+        private Connection? _connection;
+        private string? _initializationError;
+
+        private sealed record PersonParams(long Id, string? Name, double? Score);
+
+        private sealed record PersonRow(long Id, string Name);
+
+        private sealed record ValueRow(long V);
+
+        private enum Level : long { Low = 1, High = 2 }
+
+        [TestInitialize]
+        public void TestInitialize()
+        {
+            try
+            {
+                _database = new Database(":memory:");
+                _connection = _database.Connect();
+                _connection.Query("CREATE NODE TABLE Person(id INT64, name STRING, score DOUBLE, PRIMARY KEY(id));").Dispose();
+                _initializationError = null;
+            }
+            catch (KuzuException ex)
+            {
+                _database = null;
+                _connection = null;
+                _initializationError = ex.Message;
+            }
+        }
+
+        [TestCleanup]
+        public void TestCleanup()
+        {
+            _connection?.Dispose();
+            _database?.Dispose();
+        }
+
+        private void EnsureNativeLibraryAvailable()
+        {
+            if (_database == null || _connection == null)
+            {
+                throw new InvalidOperationException($"Cannot run test: Native Kuzu library is not available. Error: {_initializationError}");
+            }
+        }
+
+        [TestMethod]
+        public void Execute_AnonymousObject_ShouldBindByName()
+        {
+            EnsureNativeLibraryAvailable();
+            _connection!.Execute("CREATE (:Person {id: $id, name: $name});", new { id = 5L, name = "x" }).Dispose();
+
+            var rows = _connection.Query<PersonRow>("MATCH (p:Person) WHERE p.id = $id RETURN p.id AS id, p.name AS name;", new { id = 5L });
+            Assert.AreEqual(1, rows.Count);
+            Assert.AreEqual("x", rows[0].Name);
+        }
+
+        [TestMethod]
+        public void Execute_Record_ShouldBindNullsAsNull()
+        {
+            EnsureNativeLibraryAvailable();
+            _connection!.Execute("CREATE (:Person {id: $Id, name: $Name, score: $Score});", new PersonParams(7, "y", null)).Dispose();
+
+            using var result = _connection.Query("MATCH (p:Person) WHERE p.id = 7 RETURN p.name, p.score;");
+            var reader = result.GetReader();
+            Assert.IsTrue(reader.Read());
+            Assert.AreEqual("y", reader.GetString(0));
+            Assert.IsTrue(reader.IsNull(1));
+        }
+
+        [TestMethod]
+        public void BindParameters_Enum_ShouldBindUnderlyingValue()
+        {
+            EnsureNativeLibraryAvailable();
+            using var ps = _connection!.Prepare("RETURN $level + 1;");
+            ps.BindParameters(new { level = Level.High });
+            using var result = ps.Execute();
+            var reader = result.GetReader();
+            Assert.IsTrue(reader.Read());
+            Assert.AreEqual(3L, reader.GetInt64(0));
+        }
+
+        [TestMethod]
+        public void Execute_Dictionary_ShouldBindEntries()
+        {
+            EnsureNativeLibraryAvailable();
+            var parameters = new Dictionary<string, object> { ["id"] = 9L, ["name"] = "z" };
+            _connection!.Execute("CREATE (:Person {id: $id, name: $name});", parameters).Dispose();
+
+            Assert.AreEqual("z", _connection.Query<PersonRow>("MATCH (p:Person) RETURN p.id AS id, p.name AS name;")[0].Name);
+        }
+
+        [TestMethod]
+        public void BindParameters_UnsupportedMemberType_ShouldThrowNotSupported()
+        {
+            EnsureNativeLibraryAvailable();
+            using var ps = _connection!.Prepare("RETURN $value;");
+
+            Assert.ThrowsExactly<NotSupportedException>(() => ps.BindParameters(new { value = new Uri("http://example.com") }));
+        }
+
+        [TestMethod]
+        public void Query_ConcurrentSameTextWithCache_ShouldKeepBindingsSeparate()
+        {
+            EnsureNativeLibraryAvailable();
+            _connection!.EnablePreparedStatementCache(4);
+
+            Parallel.For(0, 200, i =>
+            {
+                var rows = _connection.Query<ValueRow>("RETURN $v AS v;", new { v = (long)i });
+                Assert.AreEqual((long)i, rows[0].V);
+            });
+        }
+    }
+}
@@ -0,0 +1,118 @@
+using System;
+using System.Linq;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+
+namespace KuzuDot.Tests
+{
+    [TestClass]
+    public class PathReadTests
+    {
+        private Database? _database;
+        private Connection? _connection;
+        private string? _initializationError;
+
+        [TestInitialize]
+        public void TestInitialize()
+        {
+            try
+            {
+                _database = new Database(":memory:");
+                _connection = _database.Connect();
+                _connection.Query("CREATE NODE TABLE Person(id INT64, name STRING, PRIMARY KEY(id));").Dispose();
+                _connection.Query("CREATE REL TABLE Knows(FROM Person TO Person, since INT32);").Dispose();
+                _connection.Query("CREATE (:Person {id: 1, name: 'a'}), (:Person {id: 2, name: 'b'}), (:Person {id: 3, name: 'c'});").Dispose();
+                _connection.Query("MATCH (a:Person {id: 1}), (b:Person {id: 2}) CREATE (a)-[:Knows {since: 2020}]->(b);").Dispose();
+                _connection.Query("MATCH (b:Person {id: 2}), (c:Person {id: 3}) CREATE (b)-[:Knows {since: 2021}]->(c);").Dispose();
+                _initializationError = null;
+            }
+            catch (KuzuException ex)
+            {
+                _database = null;
+                _connection = null;
+                _initializationError = ex.Message;
+            }
+        }
+
+        [TestCleanup]
+        public void TestCleanup()
+        {
+            _connection?.Dispose();
+            _database?.Dispose();
+        }
+
+        private void EnsureNativeLibraryAvailable()
+        {
+            if (_database == null || _connection == null)
+            {
+                throw new InvalidOperationException($"Cannot run test: Native Kuzu library is not available. Error: {_initializationError}");
+            }
+        }
+
+        [TestMethod]
+        public void ReaderReadPath_ShouldReturnChainedRelIds()
+        {
+            EnsureNativeLibraryAvailable();
+            using var result = _connection!.Query("MATCH p = (a:Person {id: 1})-[:Knows*2..2]->(c:Person) RETURN p, a, c;");
+            var reader = result.GetReader();
+            Assert.IsTrue(reader.Read());
+
+            var path = reader.ReadPath(0);
+            Assert.AreEqual(2, path.Length);
+            Assert.IsFalse(path.HasProperties);
+            Assert.AreEqual(0, path.Rels.Length);
+            Assert.AreEqual(reader.ReadNode(1).Id, path.RelSourceIds[0]);
+            Assert.AreEqual(path.RelDestinationIds[0], path.RelSourceIds[1]);
+            Assert.AreEqual(reader.ReadNode(2).Id, path.RelDestinationIds[1]);
+            Assert.IsTrue(path.NodeIds.ToArray().Contains(path.RelDestinationIds[0]));
+            Assert.AreNotEqual(path.RelIds[0], path.RelIds[1]);
+        }
+
+        [TestMethod]
+        public void ReadPath_WithProperties_ShouldDecodeNodesAndRels()
+        {
+            EnsureNativeLibraryAvailable();
+            using var result = _connection!.Query("MATCH p = (a:Person {id: 1})-[:Knows*2..2]->(c:Person) RETURN p;");
+            var reader = result.GetReader();
+            Assert.IsTrue(reader.Read());
+
+            var path = reader.ReadPath(0, includeProperties: true);
+            Assert.IsTrue(path.HasProperties);
+            Assert.AreEqual(path.NodeIds.Length, path.Nodes.Length);
+            Assert.AreEqual(2020, path.Rels[0]["since"]);
+            Assert.AreEqual(2021, path.Rels[1]["since"]);
+            Assert.AreEqual(path.RelIds[1], path.Rels[1].Id);
+            Assert.AreSame(path.Rels[0].PropertyNames, path.Rels[1].PropertyNames);
+        }
+
+        [TestMethod]
+        public void KuzuValueReadPath_ShortestPath_ShouldMatchReader()
+        {
+            EnsureNativeLibraryAvailable();
+            const string query = "MATCH p = (a:Person {id: 1})-[:Knows* SHORTEST 1..3]->(c:Person {id: 3}) RETURN p;";
+            InternalId[] expected;
+            using (var result = _connection!.Query(query))
+            {
+                var reader = result.GetReader();
+                Assert.IsTrue(reader.Read());
+                expected = reader.ReadPath(0).RelIds.ToArray();
+            }
+
+            using var again = _connection.Query(query);
+            using var tuple = again.GetNext();
+            using var value = tuple.GetValue(0);
+            var path = value.ReadPath();
+            CollectionAssert.AreEqual(expected, path.RelIds.ToArray());
+            Assert.AreEqual(2, path.Length);
+        }
+
+        [TestMethod]
+        public void ReadPath_OnScalarColumn_ShouldThrow()
+        {
+            EnsureNativeLibraryAvailable();
+            using var result = _connection!.Query("RETURN 1;");
+            var reader = result.GetReader();
+            Assert.IsTrue(reader.Read());
+            Assert.ThrowsExactly<KuzuException>(() => reader.ReadPath(0));
+        }
+    }
+}
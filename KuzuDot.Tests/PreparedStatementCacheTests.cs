@@ -0,0 +1,168 @@
+using System;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+
+namespace KuzuDot.Tests
+{
+    [TestClass]
+    public class PreparedStatementCacheTests
+    {
+        private const string AgeQuery = "MATCH (p:Person) WHERE p.name = $name RETURN p.age;";
+
+        private Database? _database;
+        private Connection? _connection;
+        private string? _initializationError;
+
+        [TestInitialize]
+        public void TestInitialize()
+        {
+            try
+            {
+                _database = new Database(":memory:");
+                _connection = _database.Connect();
+                _connection.Query("CREATE NODE TABLE Person(name STRING, age INT64, PRIMARY KEY(name));").Dispose();
+                _connection.Query("CREATE (:Person {name: 'Alice', age: 30});").Dispose();
+                _connection.Query("CREATE (:Person {name: 'Bob', age: 25});").Dispose();
+                _initializationError = null;
+            }
+            catch (KuzuException ex)
+            {
+                _database = null;
+                _connection = null;
+                _initializationError = ex.Message;
+            }
+        }
+
+        [TestCleanup]
+        public void TestCleanup()
+        {
+            _connection?.Dispose();
+            _database?.Dispose();
+        }
+
+        private void EnsureNativeLibraryAvailable()
+        {
+            if (_database == null || _connection == null)
+            {
+                throw new InvalidOperationException($"Cannot run test: Native Kuzu library is not available. Error: {_initializationError}");
+            }
+        }
+
+        [TestMethod]
+        public void Prepare_WithoutCache_ShouldReturnNewStatements()
+        {
+            EnsureNativeLibraryAvailable();
+            using var first = _connection!.Prepare(AgeQuery);
+            using var second = _connection.Prepare(AgeQuery);
+
+            Assert.IsNull(_connection.StatementCache);
+            Assert.AreNotSame(first, second);
+        }
+
+        [TestMethod]
+        public void Prepare_WithCache_ShouldReuseStatementAndCountHits()
+        {
+            EnsureNativeLibraryAvailable();
+            _connection!.EnablePreparedStatementCache(4);
+
+            foreach (var (name, age) in new[] { ("Alice", 30L), ("Bob", 25L) })
+            {
+                using var stmt = _connection.Prepare(AgeQuery);
+                stmt.BindString("name", name);
+                using var result = stmt.Execute();
+                var reader = result.GetReader();
+                Assert.IsTrue(reader.Read());
+                Assert.AreEqual(age, reader.GetInt64(0));
+            }
+
+            var cache = _connection.StatementCache!;
+            Assert.AreEqual(1, cache.Count);
+            Assert.AreEqual(1L, cache.Misses);
+            Assert.AreEqual(1L, cache.Hits);
+        }
+
+        [TestMethod]
+        public void Prepare_BeyondCapacity_ShouldEvictLeastRecentlyUsed()
+        {
+            EnsureNativeLibraryAvailable();
+            _connection!.EnablePreparedStatementCache(2);
+
+            var a = _connection.Prepare("RETURN 1;");
+            a.Dispose();
+            var b = _connection.Prepare("RETURN 2;");
+            b.Dispose();
+            Assert.AreSame(a, _connection.Prepare("RETURN 1;"));
+            a.Dispose();
+            _connection.Prepare("RETURN 3;").Dispose();
+
+            Assert.AreEqual(1L, _connection.StatementCache!.Evictions);
+            Assert.ThrowsExactly<ObjectDisposedException>(() => b.IsSuccess);
+            Assert.IsTrue(a.IsSuccess);
+        }
+
+        [TestMethod]
+        public void Eviction_OfLeasedStatement_ShouldWaitForDispose()
+        {
+            EnsureNativeLibraryAvailable();
+            _connection!.EnablePreparedStatementCache(1);
+
+            var held = _connection.Prepare("RETURN 1;");
+            _connection.Prepare("RETURN 2;").Dispose();
+
+            Assert.AreEqual(1L, _connection.StatementCache!.Evictions);
+            Assert.IsTrue(held.IsSuccess);
+            using (var result = held.Execute()) Assert.IsTrue(result.HasNext());
+            held.Dispose();
+            Assert.ThrowsExactly<ObjectDisposedException>(() => held.IsSuccess);
+        }
+
+        [TestMethod]
+        public void Prepare_WhileLeased_ShouldReturnPrivateStatement()
+        {
+            EnsureNativeLibraryAvailable();
+            _connection!.EnablePreparedStatementCache(4);
+
+            using var first = _connection.Prepare(AgeQuery);
+            var second = _connection.Prepare(AgeQuery);
+            Assert.AreNotSame(first, second);
+            Assert.AreEqual(1, _connection.StatementCache!.Count);
+
+            second.Dispose();
+            Assert.ThrowsExactly<ObjectDisposedException>(() => second.IsSuccess);
+            Assert.IsTrue(first.IsSuccess);
+        }
+
+        [TestMethod]
+        public void Prepare_WithInvalidQuery_ShouldNotBeCached()
+        {
+            EnsureNativeLibraryAvailable();
+            _connection!.EnablePreparedStatementCache(4);
+
+            using var stmt = _connection.Prepare("MATCH (x:Missing) RETURN x;");
+
+            Assert.IsFalse(stmt.IsSuccess);
+            Assert.AreEqual(0, _connection.StatementCache!.Count);
+        }
+
+        [TestMethod]
+        public void DisablePreparedStatementCache_ShouldReleaseStatements()
+        {
+            EnsureNativeLibraryAvailable();
+            _connection!.EnablePreparedStatementCache(4);
+            var stmt = _connection.Prepare(AgeQuery);
+            stmt.Dispose();
+            Assert.IsTrue(stmt.IsSuccess);
+
+            _connection.DisablePreparedStatementCache();
+
+            Assert.IsNull(_connection.StatementCache);
+            Assert.ThrowsExactly<ObjectDisposedException>(() => stmt.IsSuccess);
+        }
+
+        [TestMethod]
+        public void EnablePreparedStatementCache_WithInvalidCapacity_ShouldThrow()
+        {
+            EnsureNativeLibraryAvailable();
+            Assert.ThrowsExactly<ArgumentOutOfRangeException>(() => _connection!.EnablePreparedStatementCache(0));
+        }
+    }
+}
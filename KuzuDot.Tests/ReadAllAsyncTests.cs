@@ -0,0 +1,100 @@
+using System;
+using System.Collections.Generic;
+using System.Threading.Tasks;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+
+namespace KuzuDot.Tests
+{
+    [TestClass]
+    public class ReadAllAsyncTests
+    {
+        private Database? _database;
+        private Connection? _connection;
+        private string? _initializationError;
+
+        [TestInitialize]
+        public void TestInitialize()
+        {
+            try
+            {
+                _database = new Database(":memory:");
+                _connection = _database.Connect();
+                _initializationError = null;
+            }
+            catch (KuzuException ex)
+            {
+                _database = null;
+                _connection = null;
+                _initializationError = ex.Message;
+            }
+        }
+
+        [TestCleanup]
+        public void TestCleanup()
+        {
+            _connection?.Dispose();
+            _database?.Dispose();
+        }
+
+        private void EnsureNativeLibraryAvailable()
+        {
+            if (_database == null || _connection == null)
+            {
+                throw new InvalidOperationException($"Cannot run test: Native Kuzu library is not available. Error: {_initializationError}");
+            }
+        }
+
+        [TestMethod]
+        public async Task ReadAllAsync_ShouldStreamAllRowsInOrder()
+        {
+            EnsureNativeLibraryAvailable();
+            using var result = _connection!.Query("UNWIND range(1, 1000) AS x RETURN x;");
+
+            var values = new List<long>();
+            await foreach (var v in result.ReadAllAsync(r => r.GetInt64(0), capacity: 8))
+            {
+                values.Add(v);
+            }
+
+            Assert.AreEqual(1000, values.Count);
+            Assert.AreEqual(1L, values[0]);
+            Assert.AreEqual(1000L, values[999]);
+        }
+
+        [TestMethod]
+        public async Task ReadAllAsync_StoppedEarly_ShouldReleaseProducer()
+        {
+            EnsureNativeLibraryAvailable();
+            using var result = _connection!.Query("UNWIND range(1, 100000) AS x RETURN x;");
+
+            int count = 0;
+            await foreach (var _ in result.ReadAllAsync(r => r.GetInt64(0), capacity: 4))
+            {
+                if (++count == 10) break;
+            }
+
+            Assert.AreEqual(10, count);
+        }
+
+        [TestMethod]
+        public async Task ReadAllAsync_SelectorFailure_ShouldPropagate()
+        {
+            EnsureNativeLibraryAvailable();
+            using var result = _connection!.Query("UNWIND range(1, 10) AS x RETURN x;");
+
+            await Assert.ThrowsExactlyAsync<KuzuException>(async () =>
+            {
+                await foreach (var _ in result.ReadAllAsync(r => r.GetString(0))) { }
+            });
+        }
+
+        [TestMethod]
+        public void ReadAllAsync_WithInvalidCapacity_ShouldThrow()
+        {
+            EnsureNativeLibraryAvailable();
+            using var result = _connection!.Query("RETURN 1;");
+
+            Assert.ThrowsExactly<ArgumentOutOfRangeException>(() => result.ReadAllAsync(r => r.GetInt64(0), capacity: 0));
+        }
+    }
+}
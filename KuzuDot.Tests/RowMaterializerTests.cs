@@ -0,0 +1,134 @@
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+
+namespace KuzuDot.Tests
+{
+    [TestClass]
+    public class RowMaterializerTests
+    {
+        private Database? _database;
+        private Connection? _connection;
+        private string? _initializationError;
+
+        private sealed class Person
+        {
+            public long Id { get; set; }
+            public string? Name { get; set; }
+            public int Age { get; set; }
+            public double? Score { get; set; }
+            public DateTime Born { get; set; }
+        }
+
+        private sealed record PersonRecord(long Id, string Name);
+
+        private struct NamePoint
+        {
+            public string Name;
+            public long Id;
+        }
+
+        [TestInitialize]
+        public void TestInitialize()
+        {
+            try
+            {
+                _database = new Database(":memory:");
+                _connection = _database.Connect();
+                _connection.Query("CREATE NODE TABLE Person(id INT64, name STRING, age INT64, score DOUBLE, born DATE, tags STRING[], PRIMARY KEY(id));").Dispose();
+                _connection.Query("CREATE (:Person {id: 1, name: 'Alice', age: 30, score: 9.5, born: date('1994-05-01'), tags: ['a']});").Dispose();
+                _connection.Query("CREATE (:Person {id: 2, name: 'Bob', age: 41, born: date('1983-01-15'), tags: ['b', 'c']});").Dispose();
+                _initializationError = null;
+            }
+            catch (KuzuException ex)
+            {
+                _database = null;
+                _connection = null;
+                _initializationError = ex.Message;
+            }
+        }
+
+        [TestCleanup]
+        public void TestCleanup()
+        {
+            _connection?.Dispose();
+            _database?.Dispose();
+        }
+
+        private void EnsureNativeLibraryAvailable()
+        {
+            if (_database == null || _connection == null)
+            {
+                throw new InvalidOperationException($"Cannot run test: Native Kuzu library is not available. Error: {_initializationError}");
+            }
+        }
+
+        [TestMethod]
+        public void QueryOfT_ShouldMapPropertiesByName()
+        {
+            EnsureNativeLibraryAvailable();
+            var people = _connection!.Query<Person>("MATCH (p:Person) RETURN p.id AS id, p.name AS name, p.age AS age, p.score AS score, p.born AS born ORDER BY p.id;");
+
+            Assert.AreEqual(2, people.Count);
+            Assert.AreEqual("Alice", people[0].Name);
+            Assert.AreEqual(30, people[0].Age);
+            Assert.AreEqual(9.5, people[0].Score);
+            Assert.AreEqual(new DateTime(1994, 5, 1), people[0].Born.Date);
+            Assert.IsNull(people[1].Score);
+            Assert.AreEqual(41, people[1].Age);
+        }
+
+        [TestMethod]
+        public void QueryOfT_WithParameters_ShouldBindAndMap()
+        {
+            EnsureNativeLibraryAvailable();
+            var parameters = new Dictionary<string, object> { ["minAge"] = 35L };
+            var people = _connection!.Query<Person>("MATCH (p:Person) WHERE p.age >= $minAge RETURN p.id AS id, p.name AS name;", parameters);
+
+            Assert.AreEqual(1, people.Count);
+            Assert.AreEqual(2L, people[0].Id);
+            Assert.AreEqual("Bob", people[0].Name);
+        }
+
+        [TestMethod]
+        public void As_ShouldUseConstructorForRecords()
+        {
+            EnsureNativeLibraryAvailable();
+            using var result = _connection!.Query("MATCH (p:Person) RETURN p.name AS name, p.id AS id ORDER BY p.id;");
+            var records = result.As<PersonRecord>().ToList();
+
+            CollectionAssert.AreEqual(new[] { new PersonRecord(1, "Alice"), new PersonRecord(2, "Bob") }, records);
+        }
+
+        [TestMethod]
+        public void As_ShouldMapFieldsOfStructs()
+        {
+            EnsureNativeLibraryAvailable();
+            using var result = _connection!.Query("MATCH (p:Person) WHERE p.id = 2 RETURN p.id AS id, p.name AS name;");
+            var point = result.As<NamePoint>().Single();
+
+            Assert.AreEqual(2L, point.Id);
+            Assert.AreEqual("Bob", point.Name);
+        }
+
+        [TestMethod]
+        public void As_NestedColumnIntoString_ShouldUseTextForm()
+        {
+            EnsureNativeLibraryAvailable();
+            var rows = _connection!.Query<PersonRecord>("MATCH (p:Person) WHERE p.id = 2 RETURN p.id AS id, p.tags AS name;");
+
+            StringAssert.Contains(rows[0].Name, "b");
+            StringAssert.Contains(rows[0].Name, "c");
+        }
+
+        [TestMethod]
+        public void As_IncompatibleMember_ShouldThrowNotSupported()
+        {
+            EnsureNativeLibraryAvailable();
+            using var result = _connection!.Query("MATCH (p:Person) RETURN p.name AS age;");
+
+            Assert.ThrowsExactly<NotSupportedException>(() => result.As<Person>());
+        }
+    }
+}
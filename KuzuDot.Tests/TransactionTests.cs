@@ -0,0 +1,148 @@
+using System;
+using System.Linq;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+
+namespace KuzuDot.Tests
+{
+    [TestClass]
+    public class TransactionTests
+    {
+        private Database? _database;
+        private Connection? _connection;
+        private string? _initializationError;
+
+        [TestInitialize]
+        public void TestInitialize()
+        {
+            try
+            {
+                _database = new Database(":memory:");
+                _connection = _database.Connect();
+                _connection.Query("CREATE NODE TABLE Person(id INT64, PRIMARY KEY(id));").Dispose();
+                _initializationError = null;
+            }
+            catch (KuzuException ex)
+            {
+                _database = null;
+                _connection = null;
+                _initializationError = ex.Message;
+            }
+        }
+
+        [TestCleanup]
+        public void TestCleanup()
+        {
+            _connection?.Dispose();
+            _database?.Dispose();
+        }
+
+        private void EnsureNativeLibraryAvailable()
+        {
+            if (_database == null || _connection == null)
+            {
+                throw new InvalidOperationException($"Cannot run test: Native Kuzu library is not available. Error: {_initializationError}");
+            }
+        }
+
+        private long CountPeople()
+        {
+            using var result = _connection!.Query("MATCH (p:Person) RETURN count(p);");
+            var reader = result.GetReader();
+            Assert.IsTrue(reader.Read());
+            return reader.GetInt64(0);
+        }
+
+        [TestMethod]
+        public void Commit_ShouldPersistWrites()
+        {
+            EnsureNativeLibraryAvailable();
+            using (var tx = _connection!.BeginTransaction())
+            {
+                Assert.AreSame(tx, _connection.CurrentTransaction);
+                _connection.Query("CREATE (:Person {id: 1});").Dispose();
+                _connection.Query("CREATE (:Person {id: 2});").Dispose();
+                tx.Commit();
+                Assert.AreEqual(KuzuTransactionState.Committed, tx.State);
+            }
+            Assert.IsNull(_connection.CurrentTransaction);
+            Assert.AreEqual(2, CountPeople());
+        }
+
+        [TestMethod]
+        public void Dispose_WithoutCommit_ShouldRollBack()
+        {
+            EnsureNativeLibraryAvailable();
+            var tx = _connection!.BeginTransaction();
+            _connection.Query("CREATE (:Person {id: 1});").Dispose();
+            tx.Dispose();
+
+            Assert.AreEqual(KuzuTransactionState.RolledBack, tx.State);
+            Assert.AreEqual(0, CountPeople());
+        }
+
+        [TestMethod]
+        public void BeginTransaction_Nested_ShouldThrow()
+        {
+            EnsureNativeLibraryAvailable();
+            using var tx = _connection!.BeginTransaction();
+            Assert.ThrowsExactly<InvalidOperationException>(() => _connection.BeginTransaction());
+        }
+
+        [TestMethod]
+        public void Commit_AfterRollback_ShouldThrow()
+        {
+            EnsureNativeLibraryAvailable();
+            using var tx = _connection!.BeginTransaction();
+            tx.Rollback();
+            Assert.ThrowsExactly<InvalidOperationException>(() => tx.Commit());
+            using var next = _connection.BeginTransaction();
+            Assert.AreEqual(KuzuTransactionState.Active, next.State);
+        }
+
+        [TestMethod]
+        public void ReadOnlyTransaction_ShouldRejectWrites()
+        {
+            EnsureNativeLibraryAvailable();
+            using var tx = _connection!.BeginTransaction(readOnly: true);
+            Assert.IsTrue(tx.IsReadOnly);
+            Assert.ThrowsExactly<KuzuException>(() => _connection.Query("CREATE (:Person {id: 1});").Dispose());
+        }
+
+        [TestMethod]
+        public void ExecuteInTransactions_ShouldGroupCommits()
+        {
+            EnsureNativeLibraryAvailable();
+            var statements = Enumerable.Range(0, 25).Select(i => $"CREATE (:Person {{id: {i}}});");
+
+            var result = _connection!.ExecuteInTransactions(statements, statementsPerTransaction: 10);
+
+            Assert.AreEqual(25, result.Executions);
+            Assert.AreEqual(25, CountPeople());
+            Assert.IsNull(_connection.CurrentTransaction);
+        }
+
+        [TestMethod]
+        public void ExecuteInTransactions_Failure_ShouldKeepEarlierGroupsOnly()
+        {
+            EnsureNativeLibraryAvailable();
+            var statements = new[] { "CREATE (:Person {id: 1});", "CREATE (:Person {id: 2});", "CREATE (:Person {id: 3});", "CREATE (:Person {id: 1});" };
+
+            var ex = Assert.ThrowsExactly<KuzuException>(() => _connection!.ExecuteInTransactions(statements, statementsPerTransaction: 2));
+
+            StringAssert.Contains(ex.Message, "Statement 3");
+            Assert.AreEqual(2, CountPeople());
+        }
+
+        [TestMethod]
+        public void ExecuteBatch_RowsPerTransaction_ShouldWriteAllRows()
+        {
+            EnsureNativeLibraryAvailable();
+            using var statement = _connection!.Prepare("CREATE (:Person {id: $id});");
+
+            var result = statement.ExecuteBatch(Enumerable.Range(0, 100), (b, i) => b.BindInt64("id", i), rowsPerTransaction: 30);
+
+            Assert.AreEqual(100, result.Executions);
+            Assert.AreEqual(100, CountPeople());
+        }
+    }
+}
@@ -0,0 +1,113 @@
+using System;
+using System.Linq;
+using System.Text;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+
+namespace KuzuDot.Tests
+{
+    [TestClass]
+    public class Utf8MarshalingTests
+    {
+        private Database? _database;
+        private Connection? _connection;
+        private string? _initializationError;
+
+        [TestInitialize]
+        public void TestInitialize()
+        {
+            try
+            {
+                _database = new Database(":memory:");
+                _connection = _database.Connect();
+                _connection.Query("CREATE NODE TABLE City(id INT64, name STRING, PRIMARY KEY(id));").Dispose();
+                _initializationError = null;
+            }
+            catch (KuzuException ex)
+            {
+                _database = null;
+                _connection = null;
+                _initializationError = ex.Message;
+            }
+        }
+
+        [TestCleanup]
+        public void TestCleanup()
+        {
+            _connection?.Dispose();
+            _database?.Dispose();
+        }
+
+        private void EnsureNativeLibraryAvailable()
+        {
+            if (_database == null || _connection == null)
+            {
+                throw new InvalidOperationException($"Cannot run test: Native Kuzu library is not available. Error: {_initializationError}");
+            }
+        }
+
+        private string ReadName(long id)
+        {
+            using var result = _connection!.Query($"MATCH (c:City) WHERE c.id = {id} RETURN c.name;");
+            var reader = result.GetReader();
+            Assert.IsTrue(reader.Read());
+            return reader.GetString(0);
+        }
+
+        [TestMethod]
+        public void Query_NonAsciiLiteral_ShouldRoundTrip()
+        {
+            EnsureNativeLibraryAvailable();
+            _connection!.Query("CREATE (:City {id: 1, name: '東京 Zoë'});").Dispose();
+
+            Assert.AreEqual("東京 Zoë", ReadName(1));
+        }
+
+        [TestMethod]
+        public void QueryUtf8_ShouldExecuteEncodedText()
+        {
+            EnsureNativeLibraryAvailable();
+            _connection!.QueryUtf8(Encoding.UTF8.GetBytes("CREATE (:City {id: 2, name: 'Zürich'});")).Dispose();
+
+            Assert.AreEqual("Zürich", ReadName(2));
+        }
+
+        [TestMethod]
+        public void PrepareUtf8_BindStringUtf8_ShouldInsertEncodedValue()
+        {
+            EnsureNativeLibraryAvailable();
+            using var ps = _connection!.PrepareUtf8(Encoding.UTF8.GetBytes("CREATE (:City {id: $id, name: $name});\0"));
+            Assert.IsTrue(ps.IsSuccess, ps.ErrorMessage);
+            ps.BindInt64("id", 3);
+            ps.BindStringUtf8("name", Encoding.UTF8.GetBytes("São Paulo"));
+            ps.Execute().Dispose();
+
+            Assert.AreEqual("São Paulo", ReadName(3));
+        }
+
+        [TestMethod]
+        public void BoundParameter_BindStringUtf8_ShouldHandleLongValues()
+        {
+            EnsureNativeLibraryAvailable();
+            var longName = string.Concat(Enumerable.Repeat("Ωmega", 200));
+            using var ps = _connection!.Prepare("CREATE (:City {id: 4, name: $name});");
+            ps.GetParameter("name").BindStringUtf8(Encoding.UTF8.GetBytes(longName));
+            ps.Execute().Dispose();
+
+            Assert.AreEqual(longName, ReadName(4));
+        }
+
+        [TestMethod]
+        public void GetStringUtf8_ShouldReturnEncodedBytes()
+        {
+            EnsureNativeLibraryAvailable();
+            _connection!.Query("CREATE (:City {id: 5, name: 'Kraków'});").Dispose();
+            using var result = _connection.Query("MATCH (c:City) RETURN c.name, 'Łódź';");
+            var reader = result.GetReader();
+            Assert.IsTrue(reader.Read());
+
+            CollectionAssert.AreEqual(Encoding.UTF8.GetBytes("Kraków"), reader.GetStringUtf8(0).ToArray());
+            CollectionAssert.AreEqual(Encoding.UTF8.GetBytes("Łódź"), reader.GetStringUtf8(1).ToArray());
+            Assert.IsFalse(reader.Read());
+        }
+    }
+}
@@ -0,0 +1,104 @@
+using System;
+using System.Threading.Tasks;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+
+namespace KuzuDot.Tests
+{
+    [TestClass]
+    public class ValueLeaseTests
+    {
+        private Database? _database;
+        private Connection? _connection;
+        private string? _initializationError;
+
+        [TestInitialize]
+        public void TestInitialize()
+        {
+            try
+            {
+                _database = new Database(":memory:");
+                _connection = _database.Connect();
+                _initializationError = null;
+            }
+            catch (KuzuException ex)
+            {
+                _database = null;
+                _connection = null;
+                _initializationError = ex.Message;
+            }
+        }
+
+        [TestCleanup]
+        public void TestCleanup()
+        {
+            _connection?.Dispose();
+            _database?.Dispose();
+        }
+
+        private void EnsureNativeLibraryAvailable()
+        {
+            if (_database == null || _connection == null)
+            {
+                throw new InvalidOperationException($"Cannot run test: Native Kuzu library is not available. Error: {_initializationError}");
+            }
+        }
+
+        [TestMethod]
+        public void Getters_AfterDispose_ShouldThrowObjectDisposed()
+        {
+            EnsureNativeLibraryAvailable();
+            var value = KuzuValue.CreateInt64(42);
+            Assert.AreEqual(42L, value.GetInt64());
+            value.Dispose();
+
+            Assert.ThrowsExactly<ObjectDisposedException>(() => value.GetInt64());
+            Assert.ThrowsExactly<ObjectDisposedException>(() => value.IsNull());
+            Assert.AreEqual("[Invalid KuzuValue]", value.ToString());
+        }
+
+        [TestMethod]
+        public void CopyFrom_DisposedSource_ShouldThrowObjectDisposed()
+        {
+            EnsureNativeLibraryAvailable();
+            using var target = KuzuValue.CreateInt64(1);
+            var source = KuzuValue.CreateInt64(2);
+            source.Dispose();
+
+            Assert.ThrowsExactly<ObjectDisposedException>(() => target.CopyFrom(source));
+        }
+
+        [TestMethod]
+        public void FlatTuple_GetValue_AfterDispose_ShouldThrowObjectDisposed()
+        {
+            EnsureNativeLibraryAvailable();
+            using var result = _connection!.Query("RETURN 7;");
+            var tuple = result.GetNext();
+            using (var v = tuple.GetValue(0)) Assert.AreEqual(7L, v.GetInt64());
+            tuple.Dispose();
+
+            Assert.ThrowsExactly<ObjectDisposedException>(() => tuple.GetValue(0));
+            Assert.AreEqual(string.Empty, tuple.ToString());
+        }
+
+        [TestMethod]
+        public void ConcurrentReadsAndDispose_ShouldNotCorruptOrCrash()
+        {
+            EnsureNativeLibraryAvailable();
+            for (int round = 0; round < 50; round++)
+            {
+                var value = KuzuValue.CreateString("shared");
+                var readers = new Task[4];
+                for (int t = 0; t < readers.Length; t++)
+                {
+                    readers[t] = Task.Run(() =>
+                    {
+                        try { for (int i = 0; i < 200; i++) Assert.AreEqual("shared", value.GetString()); }
+                        catch (ObjectDisposedException) { }
+                    });
+                }
+                value.Dispose();
+                Task.WaitAll(readers);
+            }
+        }
+    }
+}
@@ -0,0 +1,332 @@
+using System;
+using System.Runtime.InteropServices;
+using KuzuDot.Native;
+
+namespace KuzuDot
+{
+    /// <summary>
+    /// Columnar reader over a <see cref="QueryResult"/> using the Arrow C Data Interface.
+    /// Each chunk exposes its columns as spans over the native Arrow buffers (no per-cell marshaling).
+    /// The schema and every chunk are released through their producer callbacks when disposed.
+    /// </summary>
+    public sealed class ArrowResultReader : IDisposable
+    {
+        private readonly QueryResult _result;
+        private readonly long _chunkSize;
+        private unsafe ArrowSchema* _schema;
+        private string[] _columnNames;
+        private bool _disposed;
+
+        internal unsafe ArrowResultReader(QueryResult result, long chunkSize)
+        {
+            if (chunkSize <= 0) throw new ArgumentOutOfRangeException(nameof(chunkSize), "Chunk size must be positive");
+            _result = result;
+            _chunkSize = chunkSize;
+            _schema = (ArrowSchema*)Marshal.AllocHGlobal(sizeof(ArrowSchema));
+            *_schema = default;
+            if (!result.TryGetArrowSchema(out var schema))
+            {
+                Marshal.FreeHGlobal((IntPtr)_schema);
+                _schema = null;
+                throw new KuzuException("Failed to get Arrow schema for query result");
+            }
+            *_schema = schema;
+        }
+
+        /// <summary>Number of rows requested per chunk.</summary>
+        public long ChunkSize => _chunkSize;
+
+        /// <summary>Number of top-level columns.</summary>
+        public unsafe int ColumnCount { get { ThrowIfDisposed(); return (int)_schema->n_children; } }
+
+        /// <summary>Column names as reported by the Arrow schema.</summary>
+        public unsafe string[] ColumnNames
+        {
+            get
+            {
+                ThrowIfDisposed();
+                if (_columnNames == null)
+                {
+                    var names = new string[_schema->n_children];
+                    for (int i = 0; i < names.Length; i++) names[i] = NativeUtil.PtrToStringUtf8(ChildSchema(i)->name) ?? string.Empty;
+                    _columnNames = names;
+                }
+                return _columnNames;
+            }
+        }
+
+        /// <summary>
+        /// Fetches the next chunk of up to <see cref="ChunkSize"/> rows.
+        /// The returned chunk owns its native buffers and must be disposed by the caller.
+        /// </summary>
+        /// <returns>False once the result has been exhausted.</returns>
+        public unsafe bool TryReadNext(out ArrowChunk chunk)
+        {
+            ThrowIfDisposed();
+            chunk = null;
+            if (!_result.HasNext()) return false;
+            if (!_result.TryGetNextArrowChunk(_chunkSize, out var array)) throw new KuzuException("Failed to get next Arrow chunk");
+            var ptr = (ArrowArray*)Marshal.AllocHGlobal(sizeof(ArrowArray));
+            *ptr = array; // move: the release callback travels with the struct
+            if (ptr->length == 0)
+            {
+                ArrowInterop.Release(ptr);
+                Marshal.FreeHGlobal((IntPtr)ptr);
+                return false;
+            }
+            chunk = new ArrowChunk(this, ptr);
+            return true;
+        }
+
+        internal unsafe ArrowSchema* ChildSchema(int index) { ThrowIfDisposed(); return ((ArrowSchema**)_schema->children)[index]; }
+
+        internal bool IsDisposed => _disposed;
+
+        private void ThrowIfDisposed() { if (_disposed) throw new ObjectDisposedException(nameof(ArrowResultReader)); }
+
+        public override string ToString() => _disposed ? "ArrowResultReader(Disposed)" : $"ArrowResultReader(Columns={ColumnCount}, ChunkSize={_chunkSize})";
+
+        public unsafe void Dispose()
+        {
+            if (_disposed) return;
+            _disposed = true;
+            if (_schema != null)
+            {
+                ArrowInterop.Release(_schema);
+                Marshal.FreeHGlobal((IntPtr)_schema);
+                _schema = null;
+            }
+            GC.SuppressFinalize(this);
+        }
+
+        ~ArrowResultReader() { Dispose(); }
+    }
+
+    /// <summary>
+    /// One record batch fetched through <see cref="ArrowResultReader"/>. Spans obtained from its columns
+    /// point into native memory and are only valid until the chunk is disposed.
+    /// </summary>
+    public sealed class ArrowChunk : IDisposable
+    {
+        private readonly ArrowResultReader _reader;
+        private unsafe ArrowArray* _array;
+
+        internal unsafe ArrowChunk(ArrowResultReader reader, ArrowArray* array)
+        {
+            _reader = reader;
+            _array = array;
+        }
+
+        internal bool IsDisposed { get; private set; }
+
+        /// <summary>Number of rows in this chunk.</summary>
+        public unsafe long Length { get { ThrowIfDisposed(); return _array->length; } }
+
+        /// <summary>Number of top-level columns.</summary>
+        public unsafe int ColumnCount { get { ThrowIfDisposed(); return (int)_array->n_children; } }
+
+        /// <summary>Gets a view over the column at the specified index.</summary>
+        public unsafe ArrowColumn GetColumn(int index)
+        {
+            ThrowIfDisposed();
+            if ((uint)index >= (uint)_array->n_children) throw new ArgumentOutOfRangeException(nameof(index));
+            var child = ((ArrowArray**)_array->children)[index];
+            return new ArrowColumn(this, child, _reader.ChildSchema(index));
+        }
+
+        /// <summary>Gets a view over the column with the specified name.</summary>
+        public ArrowColumn GetColumn(string name)
+        {
+            if (name == null) throw new ArgumentNullException(nameof(name));
+            var names = _reader.ColumnNames;
+            for (int i = 0; i < names.Length; i++) if (string.Equals(names[i], name, StringComparison.Ordinal)) return GetColumn(i);
+            throw new ArgumentException($"Column '{name}' not found", nameof(name));
+        }
+
+        internal void ThrowIfDisposed()
+        {
+            if (IsDisposed) throw new ObjectDisposedException(nameof(ArrowChunk));
+            if (_reader.IsDisposed) throw new ObjectDisposedException(nameof(ArrowResultReader)); // child schemas belong to the reader
+        }
+
+        public override string ToString() => IsDisposed ? "ArrowChunk(Disposed)" : $"ArrowChunk(Rows={Length}, Columns={ColumnCount})";
+
+        public unsafe void Dispose()
+        {
+            if (IsDisposed) return;
+            IsDisposed = true;
+            if (_array != null)
+            {
+                ArrowInterop.Release(_array);
+                Marshal.FreeHGlobal((IntPtr)_array);
+                _array = null;
+            }
+            GC.SuppressFinalize(this);
+        }
+
+        ~ArrowChunk() { Dispose(); }
+    }
+
+    /// <summary>
+    /// View over one (possibly nested) Arrow array of a chunk. Buffer layout follows the Arrow columnar format:
+    /// primitive columns expose <see cref="GetValues{T}"/>, strings/binary expose <see cref="GetOffsets"/> + <see cref="GetData"/>,
+    /// lists expose offsets plus child 0, and structs expose one child per field.
+    /// </summary>
+    public readonly unsafe struct ArrowColumn
+    {
+        private readonly ArrowChunk _owner;
+        private readonly ArrowArray* _array;
+        private readonly ArrowSchema* _schema;
+
+        internal ArrowColumn(ArrowChunk owner, ArrowArray* array, ArrowSchema* schema)
+        {
+            _owner = owner;
+            _array = array;
+            _schema = schema;
+        }
+
+        /// <summary>Field name.</summary>
+        public string Name { get { Check(); return NativeUtil.PtrToStringUtf8(_schema->name) ?? string.Empty; } }
+
+        /// <summary>Arrow format string (e.g. "l" for int64, "u" for utf8, "+l" for list, "+s" for struct).</summary>
+        public string Format { get { Check(); return NativeUtil.PtrToStringUtf8(_schema->format) ?? string.Empty; } }
+
+        public long Length { get { Check(); return _array->length; } }
+        public long NullCount { get { Check(); return _array->null_count; } }
+
+        /// <summary>Logical offset (in elements) of this array into its buffers; already applied by the span accessors.</summary>
+        public long Offset { get { Check(); return _array->offset; } }
+
+        public int ChildCount { get { Check(); return (int)_array->n_children; } }
+
+        /// <summary>Gets a child array (list values or struct field).</summary>
+        public ArrowColumn GetChild(int index)
+        {
+            Check();
+            if ((uint)index >= (uint)_array->n_children) throw new ArgumentOutOfRangeException(nameof(index));
+            return new ArrowColumn(_owner, ((ArrowArray**)_array->children)[index], ((ArrowSchema**)_schema->children)[index]);
+        }
+
+        /// <summary>
+        /// Raw validity bitmap (LSB-first, bit set = valid) covering bits [0, Offset + Length). Empty when the column has no nulls.
+        /// </summary>
+        public ReadOnlySpan<byte> ValidityBitmap
+        {
+            get
+            {
+                var buffer = Buffer(0);
+                if (buffer == null) return ReadOnlySpan<byte>.Empty;
+                return new ReadOnlySpan<byte>(buffer, checked((int)((_array->offset + _array->length + 7) / 8)));
+            }
+        }
+
+        public bool IsNull(long index)
+        {
+            CheckIndex(index);
+            if (_array->null_count == 0) return false;
+            var bitmap = (byte*)Buffer(0);
+            if (bitmap == null) return false;
+            long bit = _array->offset + index;
+            return (bitmap[bit >> 3] & (1 << (int)(bit & 7))) == 0;
+        }
+
+        /// <summary>Values of a fixed-width column as a span of <typeparamref name="T"/> (offset applied).</summary>
+        public ReadOnlySpan<T> GetValues<T>() where T : unmanaged
+        {
+            Check();
+            var width = ArrowInterop.FixedWidth(Format);
+            if (width < 0) throw new InvalidOperationException($"Column format '{Format}' is not fixed-width");
+            if (width != sizeof(T)) throw new InvalidOperationException($"Column format '{Format}' has {width}-byte elements; {typeof(T).Name} is {sizeof(T)} bytes");
+            var buffer = (T*)Buffer(1);
+            if (buffer == null) return ReadOnlySpan<T>.Empty;
+            return new ReadOnlySpan<T>(buffer + _array->offset, checked((int)_array->length));
+        }
+
+        /// <summary>Reads an element of a bit-packed boolean ("b") column.</summary>
+        public bool GetBoolean(long index)
+        {
+            CheckIndex(index);
+            if (Format != "b") throw new InvalidOperationException($"Column format '{Format}' is not boolean");
+            var bits = (byte*)Buffer(1);
+            long bit = _array->offset + index;
+            return (bits[bit >> 3] & (1 << (int)(bit & 7))) != 0;
+        }
+
+        /// <summary>32-bit offsets of a utf8/binary/list column: Length + 1 entries (offset applied).</summary>
+        public ReadOnlySpan<int> GetOffsets()
+        {
+            Check();
+            var format = Format;
+            if (format != "u" && format != "z" && format != "+l") throw new InvalidOperationException($"Column format '{format}' does not have 32-bit offsets");
+            var buffer = (int*)Buffer(1);
+            if (buffer == null) return ReadOnlySpan<int>.Empty;
+            return new ReadOnlySpan<int>(buffer + _array->offset, checked((int)_array->length + 1));
+        }
+
+        /// <summary>64-bit offsets of a large utf8/binary/list column: Length + 1 entries (offset applied).</summary>
+        public ReadOnlySpan<long> GetLargeOffsets()
+        {
+            Check();
+            var format = Format;
+            if (format != "U" && format != "Z" && format != "+L") throw new InvalidOperationException($"Column format '{format}' does not have 64-bit offsets");
+            var buffer = (long*)Buffer(1);
+            if (buffer == null) return ReadOnlySpan<long>.Empty;
+            return new ReadOnlySpan<long>(buffer + _array->offset, checked((int)_array->length + 1));
+        }
+
+        /// <summary>Character/byte data of a utf8 or binary column, addressed by <see cref="GetOffsets"/>.</summary>
+        public ReadOnlySpan<byte> GetData()
+        {
+            Check();
+            var format = Format;
+            long end;
+            if (format == "u" || format == "z") { var offsets = GetOffsets(); end = offsets.Length == 0 ? 0 : offsets[offsets.Length - 1]; }
+            else if (format == "U" || format == "Z") { var offsets = GetLargeOffsets(); end = offsets.Length == 0 ? 0 : offsets[offsets.Length - 1]; }
+            else throw new InvalidOperationException($"Column format '{format}' is not a string/binary column");
+            var buffer = (byte*)Buffer(2);
+            if (buffer == null) return ReadOnlySpan<byte>.Empty;
+            return new ReadOnlySpan<byte>(buffer, checked((int)end));
+        }
+
+        /// <summary>Raw bytes (UTF-8 for strings) of one element of a utf8/binary column.</summary>
+        public ReadOnlySpan<byte> GetBytes(long index)
+        {
+            CheckIndex(index);
+            var format = Format;
+            long start, end;
+            if (format == "u" || format == "z") { var offsets = GetOffsets(); start = offsets[(int)index]; end = offsets[(int)index + 1]; }
+            else { var offsets = GetLargeOffsets(); start = offsets[(int)index]; end = offsets[(int)index + 1]; }
+            return GetData().Slice(checked((int)start), checked((int)(end - start)));
+        }
+
+        /// <summary>Decodes one element of a utf8 column; returns null for null entries.</summary>
+        public string GetString(long index)
+        {
+            if (IsNull(index)) return null;
+            var bytes = GetBytes(index);
+            if (bytes.IsEmpty) return string.Empty;
+            fixed (byte* p = bytes) return System.Text.Encoding.UTF8.GetString(p, bytes.Length);
+        }
+
+        public override string ToString() => _owner == null || _owner.IsDisposed ? "ArrowColumn(Disposed)" : $"ArrowColumn(Name={Name}, Format={Format}, Length={Length})";
+
+        private void* Buffer(int index)
+        {
+            Check();
+            if (index >= _array->n_buffers) return null;
+            return ((void**)_array->buffers)[index];
+        }
+
+        private void Check()
+        {
+            if (_owner == null) throw new InvalidOperationException("Column is not attached to a chunk");
+            _owner.ThrowIfDisposed();
+        }
+
+        private void CheckIndex(long index)
+        {
+            Check();
+            if ((ulong)index >= (ulong)_array->length) throw new ArgumentOutOfRangeException(nameof(index));
+        }
+    }
+}
@@ -0,0 +1,28 @@
+using System;
+
+namespace KuzuDot
+{
+    /// <summary>
+    /// Aggregate outcome of <see cref="PreparedStatement.ExecuteBatch{TRow}"/>.
+    /// </summary>
+    public sealed class BatchExecutionResult
+    {
+        internal BatchExecutionResult(long executions, ulong tuplesReturned, TimeSpan elapsed)
+        {
+            Executions = executions;
+            TuplesReturned = tuplesReturned;
+            Elapsed = elapsed;
+        }
+
+        /// <summary>Number of rows executed.</summary>
+        public long Executions { get; }
+
+        /// <summary>Total number of result tuples produced across all executions (results themselves are discarded).</summary>
+        public ulong TuplesReturned { get; }
+
+        /// <summary>Wall-clock time spent binding and executing the batch.</summary>
+        public TimeSpan Elapsed { get; }
+
+        public override string ToString() => $"BatchExecutionResult(Executions={Executions}, Tuples={TuplesReturned}, Elapsed={Elapsed.TotalMilliseconds:F1}ms)";
+    }
+}
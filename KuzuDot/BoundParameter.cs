@@ -0,0 +1,79 @@
+using System;
+using KuzuDot.Native;
+using KuzuDot.Native.Enums;
+using KuzuDot.Utils;
+
+namespace KuzuDot
+{
+    /// <summary>
+    /// Pre-resolved handle to a named parameter of a <see cref="PreparedStatement"/>, obtained from
+    /// <see cref="PreparedStatement.GetParameter"/>. The native parameter name is owned by the statement, so
+    /// binding fixed-size values through the handle performs no managed or unmanaged allocation.
+    /// The handle is valid until the statement is disposed.
+    /// </summary>
+    public readonly struct BoundParameter
+    {
+        private readonly PreparedStatement _statement;
+        private readonly IntPtr _name;
+
+        internal BoundParameter(PreparedStatement statement, string name, IntPtr nativeName)
+        {
+            _statement = statement;
+            _name = nativeName;
+            Name = name;
+        }
+
+        public string Name { get; }
+
+        public void BindBool(bool value) => Check(NativeMethods.kuzu_prepared_statement_bind_bool(ref Native, _name, value));
+        public void BindInt8(sbyte value) => Check(NativeMethods.kuzu_prepared_statement_bind_int8(ref Native, _name, value));
+        public void BindInt16(short value) => Check(NativeMethods.kuzu_prepared_statement_bind_int16(ref Native, _name, value));
+        public void BindInt32(int value) => Check(NativeMethods.kuzu_prepared_statement_bind_int32(ref Native, _name, value));
+        public void BindInt64(long value) => Check(NativeMethods.kuzu_prepared_statement_bind_int64(ref Native, _name, value));
+        public void BindUInt8(byte value) => Check(NativeMethods.kuzu_prepared_statement_bind_uint8(ref Native, _name, value));
+        public void BindUInt16(ushort value) => Check(NativeMethods.kuzu_prepared_statement_bind_uint16(ref Native, _name, value));
+        public void BindUInt32(uint value) => Check(NativeMethods.kuzu_prepared_statement_bind_uint32(ref Native, _name, value));
+        public void BindUInt64(ulong value) => Check(NativeMethods.kuzu_prepared_statement_bind_uint64(ref Native, _name, value));
+        public void BindFloat(float value) => Check(NativeMethods.kuzu_prepared_statement_bind_float(ref Native, _name, value));
+        public void BindDouble(double value) => Check(NativeMethods.kuzu_prepared_statement_bind_double(ref Native, _name, value));
+        public void BindDate(DateTime value) => Check(NativeMethods.kuzu_prepared_statement_bind_date(ref Native, _name, DateTimeUtilities.DateTimeToKuzuDate(value)));
+        public void BindTimestamp(DateTime value) => Check(NativeMethods.kuzu_prepared_statement_bind_timestamp(ref Native, _name, DateTimeUtilities.DateTimeToNativeTimestamp(value)));
+        public void BindTimestampMicros(long unixMicros) => Check(NativeMethods.kuzu_prepared_statement_bind_timestamp(ref Native, _name, new KuzuTimestamp { Value = unixMicros }));
+        public void BindTimestampWithTimeZone(DateTimeOffset value) => Check(NativeMethods.kuzu_prepared_statement_bind_timestamp_tz(ref Native, _name, new KuzuTimestampTz { Value = DateTimeUtilities.DateTimeToUnixMicroseconds(value.UtcDateTime) }));
+        public void BindInterval(TimeSpan value) => Check(NativeMethods.kuzu_prepared_statement_bind_interval(ref Native, _name, DateTimeUtilities.TimeSpanToNativeInterval(value)));
+        /// <remarks>The value itself is still marshaled on every call.</remarks>
+        public void BindString(string value) => Check(NativeMethods.kuzu_prepared_statement_bind_string(ref Native, _name, value ?? string.Empty));
+        /// <summary>Binds already-encoded UTF-8 bytes; see <see cref="PreparedStatement.BindStringUtf8"/>.</summary>
+        public unsafe void BindStringUtf8(ReadOnlySpan<byte> utf8Value)
+        {
+            var terminated = NativeUtil.NullTerminate(utf8Value, stackalloc byte[256], out var rented);
+            try { fixed (byte* value = terminated) Check(NativeMethods.kuzu_prepared_statement_bind_string(ref Native, _name, (IntPtr)value)); }
+            finally { NativeUtil.Return(rented); }
+        }
+        /// <summary>Binds binary data; see <see cref="PreparedStatement.BindBlob"/>.</summary>
+        public unsafe void BindBlob(ReadOnlySpan<byte> data)
+        {
+            var text = BlobCodec.EncodeNullTerminated(data, stackalloc byte[256], out var rented);
+            try { fixed (byte* value = text) Check(NativeMethods.kuzu_prepared_statement_bind_string(ref Native, _name, (IntPtr)value)); }
+            finally { NativeUtil.Return(rented); }
+        }
+        public void BindValue(KuzuValue value) { KuzuGuard.NotNull(value, nameof(value)); Check(NativeMethods.kuzu_prepared_statement_bind_value(ref Native, _name, value.Handle.Value)); }
+
+        private ref KuzuPreparedStatement Native
+        {
+            get
+            {
+                if (_statement == null) throw new InvalidOperationException("BoundParameter is not associated with a prepared statement");
+                return ref _statement.CheckedNativeStruct;
+            }
+        }
+
+        private void Check(KuzuState state)
+        {
+            if (state != KuzuState.Success)
+                throw new KuzuException($"Failed to bind parameter '{Name}': {_statement.ErrorMessage}");
+        }
+
+        public override string ToString() => $"BoundParameter({Name})";
+    }
+}
@@ -0,0 +1,149 @@
+using System;
+using System.Globalization;
+using System.IO;
+using System.Text;
+using KuzuDot.Native;
+
+namespace KuzuDot
+{
+    /// <summary>
+    /// Writes rows in the CSV dialect that <see cref="BulkLoader"/> passes to <c>COPY</c>: comma-delimited, no header,
+    /// strings always double-quoted with embedded quotes doubled, and NULL written as an empty unquoted field.
+    /// </summary>
+    internal sealed class BulkLoadCsvWriter : IDisposable
+    {
+        private static readonly char[] LineBreaks = { '\r', '\n' };
+
+        private readonly StreamWriter _writer;
+        private bool _firstField = true;
+#if NET8_0_OR_GREATER
+        private readonly char[] _scratch = new char[64];
+#endif
+
+        internal BulkLoadCsvWriter(string path)
+        {
+            _writer = new StreamWriter(new FileStream(path, FileMode.CreateNew, FileAccess.Write, FileShare.Read, 1 << 16), new UTF8Encoding(false), 1 << 16);
+        }
+
+        /// <summary>True once a string containing CR or LF has been written; the parallel CSV reader rejects such files.</summary>
+        public bool HasQuotedLineBreak { get; private set; }
+
+        public void WriteNull() => Separator();
+        public void Write(bool value) { Separator(); _writer.Write(value ? "true" : "false"); }
+        public void Write(sbyte value) => WriteFormattable(value, null);
+        public void Write(short value) => WriteFormattable(value, null);
+        public void Write(int value) => WriteFormattable(value, null);
+        public void Write(long value) => WriteFormattable(value, null);
+        public void Write(byte value) => WriteFormattable(value, null);
+        public void Write(ushort value) => WriteFormattable(value, null);
+        public void Write(uint value) => WriteFormattable(value, null);
+        public void Write(ulong value) => WriteFormattable(value, null);
+        public void Write(float value) => WriteFormattable(value, "R");
+        public void Write(double value) => WriteFormattable(value, "R");
+        public void Write(decimal value) => WriteFormattable(value, null);
+        public void Write(Guid value) => WriteFormattable(value, "D");
+        public void Write(DateTime value) => WriteFormattable(value, value.TimeOfDay == TimeSpan.Zero ? "yyyy-MM-dd" : "yyyy-MM-dd HH:mm:ss.ffffff");
+        public void Write(DateTimeOffset value) => WriteFormattable(value.UtcDateTime, "yyyy-MM-dd HH:mm:ss.ffffff");
+
+        /// <summary>
+        /// Writes an INTERVAL as whole days plus the remaining microseconds (e.g. <c>1 days 3600000000 microseconds</c>),
+        /// the same split used when binding a <see cref="TimeSpan"/>; sub-microsecond ticks are truncated.
+        /// </summary>
+        public void Write(TimeSpan value)
+        {
+            const long microsPerDay = 86_400_000_000L;
+            var micros = value.Ticks / 10;
+            Separator();
+            _writer.Write((micros / microsPerDay).ToString(CultureInfo.InvariantCulture));
+            _writer.Write(" days ");
+            _writer.Write((micros % microsPerDay).ToString(CultureInfo.InvariantCulture));
+            _writer.Write(" microseconds");
+        }
+
+        public void Write(string value)
+        {
+            if (value == null) { WriteNull(); return; }
+            if (!HasQuotedLineBreak && value.IndexOfAny(LineBreaks) >= 0) HasQuotedLineBreak = true;
+            Separator();
+            _writer.Write('"');
+            _writer.Write(value.IndexOf('"') < 0 ? value : value.Replace("\"", "\"\""));
+            _writer.Write('"');
+        }
+
+        /// <summary>
+        /// Writes binary data as a quoted field in the engine's escaped BLOB text form (<c>\xHH</c> for non-printable bytes,
+        /// quotes and backslashes), which <c>COPY</c> parses back into the original bytes. The escapes never produce a
+        /// double quote, so the field needs no further CSV escaping.
+        /// </summary>
+        public void Write(ReadOnlySpan<byte> value)
+        {
+            Separator();
+            _writer.Write('"');
+            for (int i = 0; i < value.Length; i++)
+            {
+                var b = value[i];
+                if (BlobCodec.IsLiteral(b)) { _writer.Write((char)b); continue; }
+                _writer.Write('\\');
+                _writer.Write('x');
+                _writer.Write((char)BlobCodec.HexDigit(b >> 4));
+                _writer.Write((char)BlobCodec.HexDigit(b & 0xF));
+            }
+            _writer.Write('"');
+        }
+
+        public void Write(byte[] value)
+        {
+            if (value == null) WriteNull();
+            else Write((ReadOnlySpan<byte>)value);
+        }
+
+        /// <summary>Writes a value of any type: known types as above, other formattables in invariant culture, the rest as quoted text.</summary>
+        public void WriteObject(object value)
+        {
+            switch (value)
+            {
+                case null: WriteNull(); break;
+                case DBNull _: WriteNull(); break;
+                case string s: Write(s); break;
+                case bool b: Write(b); break;
+                case byte[] bytes: Write(bytes); break;
+                case DateTime dt: Write(dt); break;
+                case DateTimeOffset dto: Write(dto); break;
+                case TimeSpan ts: Write(ts); break;
+                case float f: Write(f); break;
+                case double d: Write(d); break;
+                case IFormattable f: Separator(); _writer.Write(f.ToString(null, CultureInfo.InvariantCulture)); break;
+                default: Write(value.ToString()); break;
+            }
+        }
+
+        public void EndRow()
+        {
+            _writer.Write('\n');
+            _firstField = true;
+        }
+
+#if NET8_0_OR_GREATER
+        private void WriteFormattable<TValue>(TValue value, string format) where TValue : ISpanFormattable
+        {
+            Separator();
+            if (value.TryFormat(_scratch, out var written, format, CultureInfo.InvariantCulture)) _writer.Write(_scratch, 0, written);
+            else _writer.Write(value.ToString(format, CultureInfo.InvariantCulture));
+        }
+#else
+        private void WriteFormattable<TValue>(TValue value, string format) where TValue : IFormattable
+        {
+            Separator();
+            _writer.Write(value.ToString(format, CultureInfo.InvariantCulture));
+        }
+#endif
+
+        private void Separator()
+        {
+            if (_firstField) _firstField = false;
+            else _writer.Write(',');
+        }
+
+        public void Dispose() => _writer.Dispose();
+    }
+}
@@ -0,0 +1,279 @@
+using System;
+using System.Collections.Generic;
+using System.Data;
+using System.Diagnostics;
+using System.IO;
+using System.Linq;
+using System.Linq.Expressions;
+using System.Reflection;
+using System.Threading;
+using Apache.Arrow;
+using KuzuDot.Utils;
+
+namespace KuzuDot
+{
+    public sealed class BulkLoadOptions
+    {
+        /// <summary>Rows staged per <c>COPY</c>; bounds the size of each temporary file and the progress granularity.</summary>
+        public int BatchSize { get; set; } = 500_000;
+        /// <summary>Directory for the staging files; the system temp directory when null.</summary>
+        public string TempDirectory { get; set; }
+        /// <summary>
+        /// Lets the engine read each staging file with multiple threads (<c>PARALLEL</c> COPY option). The parallel reader
+        /// rejects quoted line breaks, so a batch containing a string with CR or LF is always copied serially.
+        /// </summary>
+        public bool Parallel { get; set; } = true;
+
+        internal void Validate()
+        {
+            if (BatchSize <= 0) throw new ArgumentOutOfRangeException(nameof(BatchSize), "BatchSize must be positive");
+        }
+
+        public override string ToString() => $"BulkLoadOptions(BatchSize={BatchSize}, Parallel={Parallel})";
+    }
+
+    /// <summary>Progress reported by <see cref="BulkLoader"/> after each staged batch has been copied.</summary>
+    public readonly struct BulkLoadProgress
+    {
+        internal BulkLoadProgress(string table, long rowsLoaded, int batchesCompleted, TimeSpan elapsed)
+        {
+            Table = table;
+            RowsLoaded = rowsLoaded;
+            BatchesCompleted = batchesCompleted;
+            Elapsed = elapsed;
+        }
+
+        public string Table { get; }
+        /// <summary>Rows committed to the table so far.</summary>
+        public long RowsLoaded { get; }
+        public int BatchesCompleted { get; }
+        public TimeSpan Elapsed { get; }
+
+        public override string ToString() => $"BulkLoadProgress(Table={Table}, Rows={RowsLoaded}, Batches={BatchesCompleted})";
+    }
+
+    /// <summary>
+    /// Aggregate outcome of a <see cref="BulkLoader"/> load.
+    /// </summary>
+    public sealed class BulkLoadResult
+    {
+        internal BulkLoadResult(string table, long rowsLoaded, int batches, TimeSpan elapsed)
+        {
+            Table = table;
+            RowsLoaded = rowsLoaded;
+            Batches = batches;
+            Elapsed = elapsed;
+        }
+
+        public string Table { get; }
+        /// <summary>Number of rows copied into the table.</summary>
+        public long RowsLoaded { get; }
+        /// <summary>Number of <c>COPY</c> statements issued.</summary>
+        public int Batches { get; }
+        /// <summary>Wall-clock time spent staging and copying.</summary>
+        public TimeSpan Elapsed { get; }
+
+        public override string ToString() => $"BulkLoadResult(Table={Table}, Rows={RowsLoaded}, Batches={Batches}, Elapsed={Elapsed.TotalMilliseconds:F1}ms)";
+    }
+
+    /// <summary>
+    /// Loads rows into a node or rel table through the engine's <c>COPY FROM</c> pipeline instead of one <c>CREATE</c>
+    /// per row. Sources are streamed into bounded CSV staging files of <see cref="BulkLoadOptions.BatchSize"/> rows, each
+    /// copied and deleted before the next is written, so memory stays flat and disk use is bounded by one batch.
+    /// </summary>
+    /// <remarks>
+    /// Columns are written in source order and must match the table's property order (for rel tables the first two
+    /// columns are the FROM and TO primary keys). Nulls become empty fields; strings are always quoted so empty strings
+    /// survive. Each batch commits on its own unless an explicit transaction is active, so on failure earlier batches
+    /// stay applied and the exception reports how many rows were loaded.
+    /// </remarks>
+    public sealed class BulkLoader
+    {
+        private readonly Connection _connection;
+        private readonly BulkLoadOptions _options;
+
+        internal BulkLoader(Connection connection, BulkLoadOptions options)
+        {
+            options.Validate();
+            _connection = connection;
+            _options = options;
+        }
+
+        /// <summary>
+        /// Loads one row per item, with one column per public readable property or field of <typeparamref name="T"/> in
+        /// declaration order. The row writer is compiled once per type.
+        /// </summary>
+        /// <exception cref="NotSupportedException"><typeparamref name="T"/> has no public readable members, or mixes public properties and fields.</exception>
+        public BulkLoadResult Load<T>(string table, IEnumerable<T> rows, IProgress<BulkLoadProgress> progress = null, CancellationToken cancellationToken = default)
+        {
+            KuzuGuard.NotNull(rows, nameof(rows));
+            using (var enumerator = rows.GetEnumerator())
+            {
+                var write = CsvRowWriter<T>.Write;
+                return Run(table, w => { if (!enumerator.MoveNext()) return false; write(w, enumerator.Current); return true; }, progress, cancellationToken);
+            }
+        }
+
+        /// <summary>Loads every remaining record of <paramref name="reader"/>, one column per field.</summary>
+        public BulkLoadResult Load(string table, IDataReader reader, IProgress<BulkLoadProgress> progress = null, CancellationToken cancellationToken = default)
+        {
+            KuzuGuard.NotNull(reader, nameof(reader));
+            return Run(table, w =>
+            {
+                if (!reader.Read()) return false;
+                for (int i = 0; i < reader.FieldCount; i++) w.WriteObject(reader.IsDBNull(i) ? null : reader.GetValue(i));
+                return true;
+            }, progress, cancellationToken);
+        }
+
+        /// <summary>Loads the rows of <paramref name="batches"/>, one column per Arrow column.</summary>
+        /// <exception cref="NotSupportedException">A column has an Arrow type without a CSV mapping.</exception>
+        public BulkLoadResult Load(string table, IEnumerable<RecordBatch> batches, IProgress<BulkLoadProgress> progress = null, CancellationToken cancellationToken = default)
+        {
+            KuzuGuard.NotNull(batches, nameof(batches));
+            using (var enumerator = batches.GetEnumerator())
+            {
+                Action<BulkLoadCsvWriter, int>[] columns = null;
+                int length = 0, row = 0;
+                return Run(table, w =>
+                {
+                    while (row >= length)
+                    {
+                        if (!enumerator.MoveNext()) return false;
+                        var batch = enumerator.Current;
+                        columns = Enumerable.Range(0, batch.ColumnCount).Select(i => ArrowColumnWriter(batch.Column(i), batch.Schema.FieldsList[i].Name)).ToArray();
+                        length = batch.Length;
+                        row = 0;
+                    }
+                    foreach (var column in columns) column(w, row);
+                    row++;
+                    return true;
+                }, progress, cancellationToken);
+            }
+        }
+
+        /// <summary>Loads the rows of a single Arrow batch; see <see cref="Load(string, IEnumerable{RecordBatch}, IProgress{BulkLoadProgress}, CancellationToken)"/>.</summary>
+        public BulkLoadResult Load(string table, RecordBatch batch, IProgress<BulkLoadProgress> progress = null, CancellationToken cancellationToken = default)
+        {
+            KuzuGuard.NotNull(batch, nameof(batch));
+            return Load(table, new[] { batch }, progress, cancellationToken);
+        }
+
+        private BulkLoadResult Run(string table, Func<BulkLoadCsvWriter, bool> writeRow, IProgress<BulkLoadProgress> progress, CancellationToken cancellationToken)
+        {
+            KuzuGuard.NotNullOrEmpty(table, nameof(table));
+            if (table.IndexOf('`') >= 0) throw new ArgumentException("Table name cannot contain backticks", nameof(table));
+            var directory = _options.TempDirectory ?? Path.GetTempPath();
+            var stopwatch = Stopwatch.StartNew();
+            long loaded = 0;
+            int batches = 0;
+            bool more = true;
+            while (more)
+            {
+                cancellationToken.ThrowIfCancellationRequested();
+                var path = Path.Combine(directory, "kuzudot-bulk-" + Guid.NewGuid().ToString("N") + ".csv");
+                try
+                {
+                    int staged = 0;
+                    bool parallel;
+                    using (var writer = new BulkLoadCsvWriter(path))
+                    {
+                        while (staged < _options.BatchSize && (more = writeRow(writer)))
+                        {
+                            writer.EndRow();
+                            staged++;
+                        }
+                        parallel = _options.Parallel && !writer.HasQuotedLineBreak;
+                    }
+                    if (staged == 0) break;
+                    try { _connection.Query(CopyStatement(table, path, parallel)).Dispose(); }
+                    catch (KuzuException ex) { throw new KuzuException($"Bulk load into '{table}' failed after {loaded} rows", ex); }
+                    loaded += staged;
+                    batches++;
+                    progress?.Report(new BulkLoadProgress(table, loaded, batches, stopwatch.Elapsed));
+                }
+                finally
+                {
+                    try { File.Delete(path); } catch (IOException) { }
+                }
+            }
+            return new BulkLoadResult(table, loaded, batches, stopwatch.Elapsed);
+        }
+
+        private static string CopyStatement(string table, string path, bool parallel)
+        {
+            var literal = path.Replace('\\', '/').Replace("'", "\\'");
+            return $"COPY `{table}` FROM '{literal}' (HEADER=false, DELIM=',', QUOTE='\"', ESCAPE='\"', PARALLEL={(parallel ? "true" : "false")});";
+        }
+
+        private static Action<BulkLoadCsvWriter, int> ArrowColumnWriter(IArrowArray array, string name)
+        {
+            // Date/timestamp arrays derive from the integer primitive arrays, so they are matched first.
+            switch (array)
+            {
+                case Date32Array a: return (w, i) => { var v = a.GetDateTime(i); if (v.HasValue) w.Write(v.Value); else w.WriteNull(); };
+                case Date64Array a: return (w, i) => { var v = a.GetDateTime(i); if (v.HasValue) w.Write(v.Value); else w.WriteNull(); };
+                case TimestampArray a: return (w, i) => { var v = a.GetTimestamp(i); if (v.HasValue) w.Write(v.Value); else w.WriteNull(); };
+                case BooleanArray a: return (w, i) => { var v = a.GetValue(i); if (v.HasValue) w.Write(v.Value); else w.WriteNull(); };
+                case Int8Array a: return (w, i) => { var v = a.GetValue(i); if (v.HasValue) w.Write(v.Value); else w.WriteNull(); };
+                case Int16Array a: return (w, i) => { var v = a.GetValue(i); if (v.HasValue) w.Write(v.Value); else w.WriteNull(); };
+                case Int32Array a: return (w, i) => { var v = a.GetValue(i); if (v.HasValue) w.Write(v.Value); else w.WriteNull(); };
+                case Int64Array a: return (w, i) => { var v = a.GetValue(i); if (v.HasValue) w.Write(v.Value); else w.WriteNull(); };
+                case UInt8Array a: return (w, i) => { var v = a.GetValue(i); if (v.HasValue) w.Write(v.Value); else w.WriteNull(); };
+                case UInt16Array a: return (w, i) => { var v = a.GetValue(i); if (v.HasValue) w.Write(v.Value); else w.WriteNull(); };
+                case UInt32Array a: return (w, i) => { var v = a.GetValue(i); if (v.HasValue) w.Write(v.Value); else w.WriteNull(); };
+                case UInt64Array a: return (w, i) => { var v = a.GetValue(i); if (v.HasValue) w.Write(v.Value); else w.WriteNull(); };
+                case FloatArray a: return (w, i) => { var v = a.GetValue(i); if (v.HasValue) w.Write(v.Value); else w.WriteNull(); };
+                case DoubleArray a: return (w, i) => { var v = a.GetValue(i); if (v.HasValue) w.Write(v.Value); else w.WriteNull(); };
+                case StringArray a: return (w, i) => { if (a.IsNull(i)) w.WriteNull(); else w.Write(a.GetString(i)); };
+                case BinaryArray a: return (w, i) => { if (a.IsNull(i)) w.WriteNull(); else w.Write(a.GetBytes(i)); };
+                default: throw new NotSupportedException($"Arrow column '{name}' of type {array.GetType().Name} is not supported by BulkLoader");
+            }
+        }
+
+        /// <summary>Compiled per-type writer emitting one typed CSV field per public readable property/field.</summary>
+        private static class CsvRowWriter<T>
+        {
+            private static Action<BulkLoadCsvWriter, T> _write;
+
+            // Compiled on first use rather than in a static initializer, so an unsupported type surfaces as the
+            // NotSupportedException below instead of a TypeInitializationException that poisons the type for good.
+            internal static Action<BulkLoadCsvWriter, T> Write => Volatile.Read(ref _write) ?? Interlocked.CompareExchange(ref _write, Compile(), null) ?? _write;
+
+            private static Action<BulkLoadCsvWriter, T> Compile()
+            {
+                var writer = Expression.Parameter(typeof(BulkLoadCsvWriter), "writer");
+                var row = Expression.Parameter(typeof(T), "row");
+                const BindingFlags flags = BindingFlags.Public | BindingFlags.Instance;
+                // Metadata tokens follow declaration order within properties and within fields, but the two live in separate
+                // tables, so their relative order is lost; types mixing both are rejected rather than loaded into the wrong columns.
+                var properties = typeof(T).GetProperties(flags).Where(p => p.CanRead && p.GetIndexParameters().Length == 0).Cast<MemberInfo>().ToList();
+                var fields = typeof(T).GetFields(flags).Cast<MemberInfo>().ToList();
+                if (properties.Count != 0 && fields.Count != 0)
+                    throw new NotSupportedException($"Type {typeof(T)} declares both public properties and public fields, so its column order is ambiguous; expose only one kind of member");
+                var members = (properties.Count != 0 ? properties : fields)
+                    .OrderBy(m => m.MetadataToken)
+                    .Select(m => WriteMember(writer, Expression.MakeMemberAccess(row, m)))
+                    .ToList();
+                if (members.Count == 0) throw new NotSupportedException($"Type {typeof(T)} has no public readable properties or fields to load");
+                return Expression.Lambda<Action<BulkLoadCsvWriter, T>>(Expression.Block(members), writer, row).Compile();
+            }
+
+            private static Expression WriteMember(ParameterExpression writer, Expression value)
+            {
+                var writeNull = Expression.Call(writer, typeof(BulkLoadCsvWriter).GetMethod(nameof(BulkLoadCsvWriter.WriteNull)));
+                if (Nullable.GetUnderlyingType(value.Type) != null)
+                    return Expression.IfThenElse(Expression.Property(value, "HasValue"), WriteValue(writer, Expression.Property(value, "Value")), writeNull);
+                return WriteValue(writer, value);
+            }
+
+            private static Expression WriteValue(ParameterExpression writer, Expression value)
+            {
+                if (value.Type.IsEnum) value = Expression.Convert(value, Enum.GetUnderlyingType(value.Type));
+                var typed = typeof(BulkLoadCsvWriter).GetMethod(nameof(BulkLoadCsvWriter.Write), new[] { value.Type });
+                if (typed != null) return Expression.Call(writer, typed, value);
+                return Expression.Call(writer, typeof(BulkLoadCsvWriter).GetMethod(nameof(BulkLoadCsvWriter.WriteObject)), Expression.Convert(value, typeof(object)));
+            }
+        }
+    }
+}
@@ -1,5 +1,10 @@
 using System;
+using System.Collections.Generic;
+using System.Diagnostics;
 using System.Runtime.InteropServices;
+using System.Text;
+using System.Threading;
+using System.Threading.Tasks;
 using KuzuDot.Native;
 using KuzuDot.Native.Enums;
 using KuzuDot.Utils;
@@ -34,10 +39,16 @@ namespace KuzuDot
         }
 
         private readonly ConnectionSafeHandle _handle;
+        private readonly Database _database;
+        private ulong _queryTimeoutMs;
+        private PreparedStatementCache _statementCache;
+        private KuzuTransaction _transaction;
+        private NodeCache _nodeCache;
 
         internal Connection(Database database)
         {
             KuzuGuard.NotNull(database, nameof(database));
+            _database = database;
             _handle = new ConnectionSafeHandle(database.Handle); // database provides IntPtr internally
             var dbStruct = new KuzuDatabase { Database = database.Handle };
             var state = NativeMethods.kuzu_connection_init(ref dbStruct, out var nativeConn);
@@ -46,6 +57,9 @@ namespace KuzuDot
             _handle.Initialize(nativeConn.Connection);
         }
 
+        internal bool IsDisposed => _handle.IsInvalid;
+        internal Database Database => _database;
+
         private void ThrowIfInvalid()
         {
             if (_handle.IsInvalid)
@@ -80,12 +94,14 @@ namespace KuzuDot
 
         /// <summary>
         /// Sets the query timeout value in milliseconds for this connection.
+        /// Async calls also treat it as a deadline measured from the moment they are issued (including time spent queued).
         /// </summary>
         public void SetQueryTimeout(ulong timeoutMs)
         {
             var conn = GetNativeConnection();
             var state = NativeMethods.kuzu_connection_set_query_timeout(ref conn, timeoutMs);
             if (state != KuzuState.Success) throw new KuzuException("Failed to set query timeout");
+            _queryTimeoutMs = timeoutMs;
         }
 
         /// <summary>
@@ -105,19 +121,286 @@ namespace KuzuDot
             KuzuGuard.NotNullOrEmpty(query, nameof(query));
             var conn = GetNativeConnection();
             var state = NativeMethods.kuzu_connection_query(ref conn, query, out var qr);
+            NoteExecuted(StatementClassifier.MayWrite(query));
             if (state != KuzuState.Success) throw new KuzuException($"Failed to execute query: {query}");
             return new QueryResult(qr);
         }
 
+        /// <summary>
+        /// Executes a query given as UTF-8 text, skipping UTF-16 transcoding. The bytes are passed through as-is when they
+        /// end in a NUL terminator; otherwise they are copied once into a terminated buffer.
+        /// </summary>
+        public unsafe QueryResult QueryUtf8(ReadOnlySpan<byte> utf8Query)
+        {
+            if (utf8Query.IsEmpty) throw new ArgumentException("Query cannot be empty", nameof(utf8Query));
+            var conn = GetNativeConnection();
+            var terminated = NativeUtil.NullTerminate(utf8Query, stackalloc byte[512], out var rented);
+            try
+            {
+                KuzuState state;
+                KuzuQueryResult qr;
+                fixed (byte* query = terminated) state = NativeMethods.kuzu_connection_query(ref conn, (IntPtr)query, out qr);
+                NoteExecuted(StatementClassifier.MayWrite(terminated));
+                if (state != KuzuState.Success) throw new KuzuException($"Failed to execute query: {DecodeQuery(terminated)}");
+                return new QueryResult(qr);
+            }
+            finally { NativeUtil.Return(rented); }
+        }
+
+        /// <summary>
+        /// Executes a query and maps every row to <typeparamref name="T"/> by column name; see <see cref="QueryResult.As{T}"/>.
+        /// </summary>
+        public List<T> Query<T>(string query)
+        {
+            using (var result = Query(query)) return new List<T>(result.As<T>());
+        }
+
+        /// <summary>
+        /// Prepares <paramref name="query"/> (through the statement cache when enabled), binds <paramref name="parameters"/>
+        /// by name and maps every row to <typeparamref name="T"/>; see <see cref="QueryResult.As{T}"/>.
+        /// </summary>
+        public List<T> Query<T>(string query, IReadOnlyDictionary<string, object> parameters)
+        {
+            KuzuGuard.NotNull(parameters, nameof(parameters));
+            return Query<T>(query, (object)parameters);
+        }
+
+        /// <summary>
+        /// Prepares <paramref name="query"/> (through the statement cache when enabled), binds the members of
+        /// <paramref name="parameters"/> by name (see <see cref="PreparedStatement.BindParameters{TParams}"/>) and executes it.
+        /// A cached statement is leased for the duration of the call, so concurrent calls with the same query text on this
+        /// connection never bind into the same statement.
+        /// </summary>
+        public QueryResult Execute<TParams>(string query, TParams parameters)
+        {
+            using (var statement = PrepareForExecution(query)) { statement.BindParameters(parameters); return statement.Execute(); }
+        }
+
+        /// <summary>
+        /// Like <see cref="Execute{TParams}"/>, then maps every row to <typeparamref name="T"/>; see <see cref="QueryResult.As{T}"/>.
+        /// <paramref name="parameters"/> is bound by its runtime type, so anonymous objects can be passed directly.
+        /// </summary>
+        public List<T> Query<T>(string query, object parameters)
+        {
+            KuzuGuard.NotNull(parameters, nameof(parameters));
+            using (var result = Execute(query, parameters)) return new List<T>(result.As<T>());
+        }
+
+        /// <summary>
+        /// The transaction started by <see cref="BeginTransaction"/> that is still active, or null.
+        /// </summary>
+        public KuzuTransaction CurrentTransaction => Volatile.Read(ref _transaction);
+
+        /// <summary>
+        /// Starts an explicit transaction. Statements on this connection join it until it is committed or rolled back,
+        /// so a group of writes pays for one commit instead of one per statement.
+        /// </summary>
+        /// <param name="readOnly">Starts a read-only transaction, which rejects writes.</param>
+        /// <exception cref="InvalidOperationException">A transaction is already active on this connection.</exception>
+        public KuzuTransaction BeginTransaction(bool readOnly = false)
+        {
+            ThrowIfInvalid();
+            var transaction = new KuzuTransaction(this, readOnly);
+            if (Interlocked.CompareExchange(ref _transaction, transaction, null) != null)
+                throw new InvalidOperationException("A transaction is already active on this connection; nested transactions are not supported");
+            try { ExecuteNonQuery(readOnly ? "BEGIN TRANSACTION READ ONLY;" : "BEGIN TRANSACTION;"); }
+            catch
+            {
+                Volatile.Write(ref _transaction, null);
+                throw;
+            }
+            return transaction;
+        }
+
+        internal void EndTransaction(KuzuTransaction transaction) => Interlocked.CompareExchange(ref _transaction, null, transaction);
+
+        /// <summary>
+        /// Runs <paramref name="statements"/> in order, committing once per <paramref name="statementsPerTransaction"/>
+        /// statements. On failure the current group is rolled back, earlier groups stay committed, and the exception
+        /// names the failing statement.
+        /// </summary>
+        /// <exception cref="InvalidOperationException">A transaction is already active on this connection.</exception>
+        public BatchExecutionResult ExecuteInTransactions(IEnumerable<string> statements, int statementsPerTransaction = 1000)
+        {
+            KuzuGuard.NotNull(statements, nameof(statements));
+            if (statementsPerTransaction <= 0) throw new ArgumentOutOfRangeException(nameof(statementsPerTransaction), "statementsPerTransaction must be positive");
+            return RunInTransactions(statements, statementsPerTransaction, (statement, index) =>
+            {
+                try { return ExecuteNonQuery(statement); }
+                catch (KuzuException ex) { throw new KuzuException($"Statement {index} failed: {ex.Message}", ex); }
+            });
+        }
+
+        /// <summary>Executes rows through <paramref name="execute"/>, wrapping each run of <paramref name="perTransaction"/> in a transaction.</summary>
+        internal BatchExecutionResult RunInTransactions<TRow>(IEnumerable<TRow> rows, int perTransaction, Func<TRow, long, ulong> execute)
+        {
+            var stopwatch = Stopwatch.StartNew();
+            long executions = 0;
+            ulong tuples = 0;
+            KuzuTransaction transaction = null;
+            try
+            {
+                foreach (var row in rows)
+                {
+                    transaction ??= BeginTransaction();
+                    tuples += execute(row, executions);
+                    executions++;
+                    if (executions % perTransaction != 0) continue;
+                    transaction.Commit();
+                    transaction = null;
+                }
+                transaction?.Commit();
+            }
+            finally
+            {
+                transaction?.Dispose();
+            }
+            return new BatchExecutionResult(executions, tuples, stopwatch.Elapsed);
+        }
+
+        /// <summary>
+        /// Projects a subgraph into an in-memory CSR adjacency structure for analytics in managed code. Both queries are
+        /// read through the Arrow chunk path, so ids are copied straight out of columnar buffers.
+        /// </summary>
+        /// <param name="nodeQuery">Returns the vertex set in its first column, as nodes or as <c>ID(n)</c> values.</param>
+        /// <param name="relQuery">Returns each rel's source and destination in its first two columns, as nodes or <c>ID(n)</c> values.
+        /// Rels with an endpoint outside the vertex set are skipped.</param>
+        /// <param name="directed">When false, every rel is stored in both directions.</param>
+        public GraphProjection ProjectGraph(string nodeQuery, string relQuery, bool directed = true)
+        {
+            KuzuGuard.NotNullOrEmpty(nodeQuery, nameof(nodeQuery));
+            KuzuGuard.NotNullOrEmpty(relQuery, nameof(relQuery));
+            var builder = new GraphProjection.Builder();
+            using (var nodes = Query(nodeQuery)) builder.AddNodes(nodes);
+            using (var rels = Query(relQuery)) builder.AddEdges(rels);
+            return builder.Build(directed);
+        }
+
+        /// <summary>
+        /// Gets the node cache of this connection, or null when it is disabled.
+        /// </summary>
+        public NodeCache NodeCache => _nodeCache;
+
+        /// <summary>
+        /// Enables a bounded cache of materialized nodes keyed by <see cref="InternalId"/>, loaded through this connection.
+        /// Replaces (and releases) any existing cache. Entries are dropped whenever <see cref="Database.WriteGeneration"/>
+        /// changes; see <see cref="NodeCache"/>.
+        /// </summary>
+        public void EnableNodeCache(NodeCacheOptions options = null)
+        {
+            ThrowIfInvalid();
+            options ??= new NodeCacheOptions();
+            options.Validate();
+            Interlocked.Exchange(ref _nodeCache, new NodeCache(this, options))?.Release();
+        }
+
+        /// <summary>
+        /// Disables the node cache and releases its entries.
+        /// </summary>
+        public void DisableNodeCache()
+        {
+            Interlocked.Exchange(ref _nodeCache, null)?.Release();
+        }
+
+        /// <summary>
+        /// Creates a <see cref="BulkLoader"/> that loads rows into tables on this connection through <c>COPY FROM</c>.
+        /// </summary>
+        public BulkLoader CreateBulkLoader(BulkLoadOptions options = null) => new BulkLoader(this, options ?? new BulkLoadOptions());
+
+        private PreparedStatement PrepareForExecution(string query)
+        {
+            var statement = Prepare(query);
+            if (statement.IsSuccess) return statement;
+            var message = statement.ErrorMessage;
+            statement.Dispose();
+            throw new KuzuException($"Failed to prepare query: {message}");
+        }
+
+        /// <summary>
+        /// Executes a query on a dedicated native-call thread. Cancelling <paramref name="cancellationToken"/> interrupts the
+        /// running query (which also interrupts any other query running concurrently on this connection).
+        /// </summary>
+        /// <exception cref="OperationCanceledException">The token was cancelled before or during execution.</exception>
+        /// <exception cref="TimeoutException">The timeout set through <see cref="SetQueryTimeout"/> elapsed.</exception>
+        public Task<QueryResult> QueryAsync(string query, CancellationToken cancellationToken = default)
+        {
+            KuzuGuard.NotNullOrEmpty(query, nameof(query));
+            ThrowIfInvalid();
+            return RunInterruptibleAsync(() => Query(query), cancellationToken);
+        }
+
         /// <summary>
         /// Prepares a statement for execution.
+        /// When the prepared-statement cache is enabled, a previously prepared statement for the same query text is
+        /// leased to the caller without re-planning until it is disposed; see <see cref="PreparedStatementCache"/> for the
+        /// ownership rules.
         /// </summary>
         public PreparedStatement Prepare(string query)
         {
             KuzuGuard.NotNullOrEmpty(query, nameof(query));
+            var cache = _statementCache;
+            if (cache != null && cache.TryGet(query, out var cached)) return cached;
+            var statement = PrepareUncached(query);
+            if (cache == null || !statement.IsSuccess) return statement;
+            return cache.Add(query, statement);
+        }
+
+        /// <summary>Prepares a statement owned by the caller, bypassing the prepared-statement cache.</summary>
+        internal PreparedStatement PrepareUncached(string query)
+        {
             var conn = GetNativeConnection();
-            var state = NativeMethods.kuzu_connection_prepare(ref conn, query, out var ps);
-            return new PreparedStatement(ps, this);
+            NativeMethods.kuzu_connection_prepare(ref conn, query, out var ps);
+            return new PreparedStatement(ps, this, query);
+        }
+
+        /// <summary>
+        /// Prepares a statement from UTF-8 query text. When the prepared-statement cache is enabled the text is decoded
+        /// once to form the cache key; otherwise it is handed to the engine without transcoding.
+        /// </summary>
+        public unsafe PreparedStatement PrepareUtf8(ReadOnlySpan<byte> utf8Query)
+        {
+            if (utf8Query.IsEmpty) throw new ArgumentException("Query cannot be empty", nameof(utf8Query));
+            if (_statementCache != null) return Prepare(DecodeQuery(utf8Query));
+            var conn = GetNativeConnection();
+            var terminated = NativeUtil.NullTerminate(utf8Query, stackalloc byte[512], out var rented);
+            try
+            {
+                KuzuPreparedStatement ps;
+                fixed (byte* query = terminated) NativeMethods.kuzu_connection_prepare(ref conn, (IntPtr)query, out ps);
+                return new PreparedStatement(ps, this, null) { MayWrite = StatementClassifier.MayWrite(terminated) };
+            }
+            finally { NativeUtil.Return(rented); }
+        }
+
+        private static unsafe string DecodeQuery(ReadOnlySpan<byte> utf8Query)
+        {
+            if (!utf8Query.IsEmpty && utf8Query[utf8Query.Length - 1] == 0) utf8Query = utf8Query.Slice(0, utf8Query.Length - 1);
+            if (utf8Query.IsEmpty) return string.Empty;
+            fixed (byte* p = utf8Query) return Encoding.UTF8.GetString(p, utf8Query.Length);
+        }
+
+        /// <summary>
+        /// Gets the prepared-statement cache of this connection, or null when caching is disabled.
+        /// </summary>
+        public PreparedStatementCache StatementCache => _statementCache;
+
+        /// <summary>
+        /// Enables an LRU cache of up to <paramref name="capacity"/> prepared statements keyed by query text.
+        /// Replaces (and releases) any existing cache.
+        /// </summary>
+        public void EnablePreparedStatementCache(int capacity)
+        {
+            ThrowIfInvalid();
+            var previous = Interlocked.Exchange(ref _statementCache, new PreparedStatementCache(capacity));
+            previous?.Clear();
+        }
+
+        /// <summary>
+        /// Disables prepared-statement caching and releases all cached statements.
+        /// </summary>
+        public void DisablePreparedStatementCache()
+        {
+            Interlocked.Exchange(ref _statementCache, null)?.Clear();
         }
 
         internal QueryResult Execute(PreparedStatement preparedStatement)
@@ -126,6 +409,7 @@ namespace KuzuDot
             var conn = GetNativeConnection();
             ref var psStruct = ref preparedStatement.NativeStruct;
             var state = NativeMethods.kuzu_connection_execute(ref conn, ref psStruct, out var qr);
+            NoteExecuted(preparedStatement.MayWrite);
             if (state != KuzuState.Success)
             {
                 string details = string.Empty;
@@ -135,6 +419,101 @@ namespace KuzuDot
             return new QueryResult(qr);
         }
 
+        internal ulong ExecuteDiscardingResult(PreparedStatement preparedStatement, long rowIndex)
+        {
+            var conn = GetNativeConnection();
+            var state = NativeMethods.kuzu_connection_execute(ref conn, ref preparedStatement.NativeStruct, out var qr);
+            NoteExecuted(preparedStatement.MayWrite);
+            try
+            {
+                if (state != KuzuState.Success || qr.QueryResult == IntPtr.Zero || !NativeMethods.kuzu_query_result_is_success(ref qr))
+                {
+                    var details = qr.QueryResult == IntPtr.Zero
+                        ? preparedStatement.ErrorMessage
+                        : NativeUtil.PtrToStringAndDestroy(NativeMethods.kuzu_query_result_get_error_message(ref qr), NativeMethods.kuzu_destroy_string);
+                    throw new KuzuException($"Failed to execute prepared statement for batch row {rowIndex}: {details}");
+                }
+                return NativeMethods.kuzu_query_result_get_num_tuples(ref qr);
+            }
+            finally
+            {
+                if (qr.QueryResult != IntPtr.Zero) NativeMethods.kuzu_query_result_destroy(ref qr);
+            }
+        }
+
+        /// <summary>Runs a statement whose result is not needed, reporting the engine's error message on failure.</summary>
+        internal ulong ExecuteNonQuery(string query)
+        {
+            var conn = GetNativeConnection();
+            var state = NativeMethods.kuzu_connection_query(ref conn, query, out var qr);
+            NoteExecuted(StatementClassifier.MayWrite(query));
+            try
+            {
+                if (state != KuzuState.Success || qr.QueryResult == IntPtr.Zero || !NativeMethods.kuzu_query_result_is_success(ref qr))
+                {
+                    var details = qr.QueryResult == IntPtr.Zero
+                        ? "no result returned"
+                        : NativeUtil.PtrToStringAndDestroy(NativeMethods.kuzu_query_result_get_error_message(ref qr), NativeMethods.kuzu_destroy_string);
+                    throw new KuzuException($"Failed to execute '{query}': {details}");
+                }
+                return NativeMethods.kuzu_query_result_get_num_tuples(ref qr);
+            }
+            finally
+            {
+                if (qr.QueryResult != IntPtr.Zero) NativeMethods.kuzu_query_result_destroy(ref qr);
+            }
+        }
+
+        /// <summary>
+        /// Invalidates <see cref="NodeCache"/>s on this database after a statement that may have written, whether or not it
+        /// succeeded: a failed statement inside a transaction rolls back writes that may already have been read.
+        /// </summary>
+        private void NoteExecuted(bool mayWrite)
+        {
+            if (mayWrite) _database.BumpWriteGeneration();
+        }
+
+        internal Task<QueryResult> ExecuteAsync(PreparedStatement preparedStatement, CancellationToken cancellationToken)
+        {
+            KuzuGuard.NotNull(preparedStatement, nameof(preparedStatement));
+            ThrowIfInvalid();
+            return RunInterruptibleAsync(() => Execute(preparedStatement), cancellationToken);
+        }
+
+        private async Task<T> RunInterruptibleAsync<T>(Func<T> call, CancellationToken cancellationToken)
+        {
+            var timeoutMs = _queryTimeoutMs;
+            using var deadline = timeoutMs == 0 ? null : CancellationTokenSource.CreateLinkedTokenSource(cancellationToken);
+            deadline?.CancelAfter((int)Math.Min(timeoutMs, int.MaxValue));
+            var token = deadline?.Token ?? cancellationToken;
+            try
+            {
+                return await NativeCallScheduler.Shared.Run(() => InvokeInterruptible(call, token), token).ConfigureAwait(false);
+            }
+            catch (Exception ex) when ((ex is OperationCanceledException || ex is KuzuException) && token.IsCancellationRequested && !cancellationToken.IsCancellationRequested)
+            {
+                throw new TimeoutException($"Query exceeded the connection timeout of {timeoutMs} ms", ex);
+            }
+            catch (KuzuException ex) when (cancellationToken.IsCancellationRequested)
+            {
+                throw new OperationCanceledException("Query was interrupted", ex, cancellationToken);
+            }
+        }
+
+        private T InvokeInterruptible<T>(Func<T> call, CancellationToken token)
+        {
+            token.ThrowIfCancellationRequested();
+            using (token.Register(s => ((Connection)s).TryInterrupt(), this))
+            {
+                return call();
+            }
+        }
+
+        private void TryInterrupt()
+        {
+            try { Interrupt(); } catch (ObjectDisposedException) { }
+        }
+
         /// <summary>
         /// Returns a string that represents the current object.
         /// </summary>
@@ -145,6 +524,10 @@ namespace KuzuDot
         /// </summary>
         public void Dispose()
         {
+            // Closing the native connection discards an open transaction; this only resets the wrapper's state.
+            Volatile.Read(ref _transaction)?.Dispose();
+            DisablePreparedStatementCache();
+            DisableNodeCache();
             _handle.Dispose();
             GC.SuppressFinalize(this);
         }
@@ -1,5 +1,6 @@
 using System;
 using System.Runtime.InteropServices;
+using System.Threading;
 using KuzuDot.Native;
 using KuzuDot.Native.Enums;
 using KuzuDot.Utils;
@@ -73,6 +74,7 @@ namespace KuzuDot
 
         private readonly DatabaseSafeHandle _handle = new DatabaseSafeHandle();
         private readonly string _path;
+        private long _writeGeneration;
 
         /// <summary>
         /// Initializes a new database instance at the specified path with default configuration.
@@ -120,6 +122,14 @@ namespace KuzuDot
             }
         }
 
+        /// <summary>
+        /// Incremented after every statement that may write (see <see cref="NodeCache"/>), and on transaction commit and
+        /// rollback, on any connection to this database. Writes made outside this wrapper are not counted.
+        /// </summary>
+        public long WriteGeneration => Interlocked.Read(ref _writeGeneration);
+
+        internal void BumpWriteGeneration() => Interlocked.Increment(ref _writeGeneration);
+
         /// <summary>
         /// Creates a new connection to this database.
         /// Multiple connections can be created and used concurrently.
@@ -133,6 +143,29 @@ namespace KuzuDot
             return new Connection(this);
         }
 
+        /// <summary>
+        /// Creates a pool that leases and reuses connections to this database.
+        /// The pool must be disposed before the database.
+        /// </summary>
+        /// <param name="options">Pool sizing and per-connection settings; defaults are used when null.</param>
+        /// <exception cref="ObjectDisposedException">Thrown when the database has been disposed.</exception>
+        public KuzuConnectionPool CreateConnectionPool(KuzuConnectionPoolOptions options = null)
+        {
+            ThrowIfDisposed();
+            return new KuzuConnectionPool(this, options ?? new KuzuConnectionPoolOptions());
+        }
+
+        /// <summary>
+        /// Creates an ingestor that shards batched write statements across several connections to this database.
+        /// </summary>
+        /// <param name="options">Parallelism, batching and retry settings; defaults are used when null.</param>
+        /// <exception cref="ObjectDisposedException">Thrown when the database has been disposed.</exception>
+        public ParallelIngestor CreateParallelIngestor(ParallelIngestOptions options = null)
+        {
+            ThrowIfDisposed();
+            return new ParallelIngestor(this, options ?? new ParallelIngestOptions());
+        }
+
         public override string ToString() => _handle.IsInvalid ? "Database(Disposed)" : $"Database(Path={_path ?? ""})";
 
         /// <summary>
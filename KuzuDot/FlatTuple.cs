@@ -33,7 +33,6 @@ namespace KuzuDot
         }
 
         private readonly FlatTupleSafeHandle _handle = new FlatTupleSafeHandle();
-        private readonly object _lockObject = new object();
 
         internal FlatTuple(KuzuFlatTuple native)
         {
@@ -46,6 +45,8 @@ namespace KuzuDot
         /// </summary>
         public ulong Size { get; internal set; }
 
+        internal GraphSchemaCache GraphSchemas { get; set; }
+
         /// <summary>
         /// Gets the value at the specified index
         /// </summary>
@@ -53,15 +54,16 @@ namespace KuzuDot
         /// <returns>A KuzuValue representing the value at the specified index</returns>
         public KuzuValue GetValue(ulong index)
         {
-            lock (_lockObject)
+            using (var lease = new SafeHandleLease(_handle, nameof(FlatTuple)))
             {
-                ThrowIfDisposed();
-                var native = new KuzuFlatTuple { FlatTuple = _handle.DangerousGetHandle(), IsOwnedByCpp = _handle.IsOwnedByCpp };
+                var native = new KuzuFlatTuple { FlatTuple = lease.Pointer, IsOwnedByCpp = _handle.IsOwnedByCpp };
                 var state = NativeMethods.kuzu_flat_tuple_get_value(ref native, index, out var borrowed);
                 if (state != KuzuState.Success) throw new KuzuException($"Failed to get value at index {index}. Native result: {state}");
                 if (borrowed.Value == IntPtr.Zero) throw new KuzuException($"Retrieved null handle for value at index {index}");
                 borrowed.IsOwnedByCpp = true;
-                return KuzuValue.CreateBorrowedFromRaw(borrowed);
+                var value = KuzuValue.CreateBorrowedFromRaw(borrowed);
+                value.GraphSchemas = GraphSchemas;
+                return value;
             }
         }
 
@@ -71,10 +73,10 @@ namespace KuzuDot
         /// <returns>A string representation of this flat tuple</returns>
         public override string ToString()
         {
-            lock (_lockObject)
+            if (_handle.IsClosed || _handle.IsInvalid) return string.Empty;
+            using (var lease = new SafeHandleLease(_handle, nameof(FlatTuple)))
             {
-                if (_handle.IsInvalid) return string.Empty;
-                var native = new KuzuFlatTuple { FlatTuple = _handle.DangerousGetHandle(), IsOwnedByCpp = _handle.IsOwnedByCpp };
+                var native = new KuzuFlatTuple { FlatTuple = lease.Pointer, IsOwnedByCpp = _handle.IsOwnedByCpp };
                 var strPtr = NativeMethods.kuzu_flat_tuple_to_string(ref native);
                 var row = NativeUtil.PtrToStringAndDestroy(strPtr, NativeMethods.kuzu_destroy_string);
                 return $"FlatTuple(Size={Size}) " + row;
@@ -89,7 +91,5 @@ namespace KuzuDot
             _handle.Dispose();
             GC.SuppressFinalize(this);
         }
-
-        private void ThrowIfDisposed() { if (_handle.IsInvalid) throw new ObjectDisposedException(nameof(FlatTuple)); }
     }
 }
\ No newline at end of file
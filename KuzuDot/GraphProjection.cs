@@ -0,0 +1,265 @@
+using System;
+using System.Buffers;
+using System.Collections.Generic;
+
+namespace KuzuDot
+{
+    /// <summary>
+    /// An in-memory adjacency snapshot of a subgraph in compressed sparse row (CSR) form, built by
+    /// <see cref="Connection.ProjectGraph"/> for running iterative algorithms (BFS, PageRank, components) in managed code.
+    /// Vertices are numbered densely 0..<see cref="VertexCount"/>-1 in node-query order; the out-neighbors of vertex
+    /// <c>v</c> are <c>Neighbors[Offsets[v]..Offsets[v + 1]]</c>.
+    /// </summary>
+    public sealed class GraphProjection
+    {
+        private readonly InternalId[] _vertexIds;
+        private readonly Dictionary<ulong, int[]> _vertexByOffset;
+        private readonly long[] _offsets;
+        private readonly int[] _neighbors;
+
+        internal GraphProjection(InternalId[] vertexIds, Dictionary<ulong, int[]> vertexByOffset, long[] offsets, int[] neighbors, long skippedEdges, bool directed)
+        {
+            _vertexIds = vertexIds;
+            _vertexByOffset = vertexByOffset;
+            _offsets = offsets;
+            _neighbors = neighbors;
+            SkippedEdges = skippedEdges;
+            IsDirected = directed;
+        }
+
+        public int VertexCount => _vertexIds.Length;
+        /// <summary>Number of stored adjacency entries (twice the projected rels for an undirected projection).</summary>
+        public long EdgeCount => _neighbors.Length;
+        /// <summary>Rels dropped because an endpoint was not returned by the node query (or was NULL).</summary>
+        public long SkippedEdges { get; }
+        public bool IsDirected { get; }
+
+        /// <summary>CSR row offsets: <see cref="VertexCount"/> + 1 entries.</summary>
+        public ReadOnlySpan<long> Offsets => _offsets;
+        /// <summary>CSR column indices (dense vertex numbers), grouped by source vertex.</summary>
+        public ReadOnlySpan<int> Neighbors => _neighbors;
+
+        public ReadOnlySpan<int> GetNeighbors(int vertex)
+        {
+            CheckVertex(vertex);
+            var start = _offsets[vertex];
+            return new ReadOnlySpan<int>(_neighbors, (int)start, (int)(_offsets[vertex + 1] - start));
+        }
+
+        public int GetOutDegree(int vertex)
+        {
+            CheckVertex(vertex);
+            return (int)(_offsets[vertex + 1] - _offsets[vertex]);
+        }
+
+        /// <summary>Gets the database id of a dense vertex number.</summary>
+        public InternalId GetVertexId(int vertex)
+        {
+            CheckVertex(vertex);
+            return _vertexIds[vertex];
+        }
+
+        /// <summary>Maps a database node id to its dense vertex number.</summary>
+        public bool TryGetVertex(InternalId id, out int vertex)
+        {
+            vertex = -1;
+            if (!_vertexByOffset.TryGetValue(id.TableId, out var byOffset) || id.Offset >= (ulong)byOffset.Length) return false;
+            vertex = byOffset[id.Offset];
+            return vertex >= 0;
+        }
+
+        private void CheckVertex(int vertex)
+        {
+            if ((uint)vertex >= (uint)_vertexIds.Length) throw new ArgumentOutOfRangeException(nameof(vertex), vertex, $"Vertex must be between 0 and {_vertexIds.Length - 1}");
+        }
+
+        public override string ToString() => $"GraphProjection(Vertices={VertexCount}, Edges={EdgeCount}, Skipped={SkippedEdges}, Directed={IsDirected})";
+
+        /// <summary>
+        /// Fills a projection from two results through <see cref="ArrowResultReader"/>, reading id columns as spans over
+        /// the Arrow buffers. Edge endpoints are staged in pooled arrays and placed by a counting sort on the source vertex.
+        /// </summary>
+        internal sealed class Builder
+        {
+            private const long ChunkSize = 1 << 16;
+
+            private readonly Dictionary<ulong, int[]> _vertexByOffset = new Dictionary<ulong, int[]>();
+            private readonly List<InternalId> _vertexIds = new List<InternalId>();
+            private int[] _sources = ArrayPool<int>.Shared.Rent(1024);
+            private int[] _targets = ArrayPool<int>.Shared.Rent(1024);
+            private int _edgeCount;
+            private long _skipped;
+            private ulong _lastTable = ulong.MaxValue;
+            private int[] _lastByOffset;
+
+            internal void AddNodes(QueryResult nodes)
+            {
+                using (var reader = nodes.GetArrowReader(ChunkSize))
+                {
+                    if (reader.ColumnCount < 1) throw new KuzuException("Node query must return a node or node id column");
+                    while (reader.TryReadNext(out var chunk))
+                    {
+                        using (chunk)
+                        {
+                            var column = IdColumn(chunk.GetColumn(0), "node");
+                            var offsets = column.GetChild(OffsetChild(column)).GetValues<long>();
+                            var tables = column.GetChild(1 - OffsetChild(column)).GetValues<long>();
+                            bool hasNulls = column.NullCount != 0;
+                            for (int i = 0; i < offsets.Length; i++)
+                            {
+                                if (hasNulls && column.IsNull(i)) continue;
+                                AddVertex((ulong)tables[i], (ulong)offsets[i]);
+                            }
+                        }
+                    }
+                }
+            }
+
+            internal void AddEdges(QueryResult rels)
+            {
+                using (var reader = rels.GetArrowReader(ChunkSize))
+                {
+                    if (reader.ColumnCount < 2) throw new KuzuException("Rel query must return source and destination node id columns");
+                    while (reader.TryReadNext(out var chunk))
+                    {
+                        using (chunk)
+                        {
+                            var source = IdColumn(chunk.GetColumn(0), "source");
+                            var target = IdColumn(chunk.GetColumn(1), "destination");
+                            var sourceOffsets = source.GetChild(OffsetChild(source)).GetValues<long>();
+                            var sourceTables = source.GetChild(1 - OffsetChild(source)).GetValues<long>();
+                            var targetOffsets = target.GetChild(OffsetChild(target)).GetValues<long>();
+                            var targetTables = target.GetChild(1 - OffsetChild(target)).GetValues<long>();
+                            bool hasNulls = source.NullCount != 0 || target.NullCount != 0;
+                            for (int i = 0; i < sourceOffsets.Length; i++)
+                            {
+                                if (hasNulls && (source.IsNull(i) || target.IsNull(i))) { _skipped++; continue; }
+                                int from = Lookup((ulong)sourceTables[i], (ulong)sourceOffsets[i]);
+                                int to = Lookup((ulong)targetTables[i], (ulong)targetOffsets[i]);
+                                if (from < 0 || to < 0) { _skipped++; continue; }
+                                AddEdge(from, to);
+                            }
+                        }
+                    }
+                }
+            }
+
+            internal GraphProjection Build(bool directed)
+            {
+                try
+                {
+                    int vertexCount = _vertexIds.Count;
+                    long entries = directed ? _edgeCount : 2L * _edgeCount;
+                    if (entries > int.MaxValue) throw new KuzuException($"Projection has {entries} adjacency entries; at most {int.MaxValue} are supported");
+                    var offsets = new long[vertexCount + 1];
+                    for (int e = 0; e < _edgeCount; e++)
+                    {
+                        offsets[_sources[e] + 1]++;
+                        if (!directed) offsets[_targets[e] + 1]++;
+                    }
+                    for (int v = 0; v < vertexCount; v++) offsets[v + 1] += offsets[v];
+                    var neighbors = new int[entries];
+                    var cursor = new long[vertexCount];
+                    Array.Copy(offsets, cursor, vertexCount);
+                    for (int e = 0; e < _edgeCount; e++)
+                    {
+                        neighbors[cursor[_sources[e]]++] = _targets[e];
+                        if (!directed) neighbors[cursor[_targets[e]]++] = _sources[e];
+                    }
+                    return new GraphProjection(_vertexIds.ToArray(), _vertexByOffset, offsets, neighbors, _skipped, directed);
+                }
+                finally
+                {
+                    ArrayPool<int>.Shared.Return(_sources);
+                    ArrayPool<int>.Shared.Return(_targets);
+                    _sources = _targets = null;
+                }
+            }
+
+            private void AddVertex(ulong table, ulong offset)
+            {
+                if (offset >= int.MaxValue) throw new KuzuException($"Node offset {offset} is too large to project");
+                if (!_vertexByOffset.TryGetValue(table, out var byOffset))
+                {
+                    byOffset = NewOffsetMap(Math.Max(1024, (int)offset + 1));
+                    _vertexByOffset[table] = byOffset;
+                }
+                if (offset >= (ulong)byOffset.Length)
+                {
+                    var grown = NewOffsetMap((int)Math.Min(int.MaxValue - 1, Math.Max((long)byOffset.Length * 2, (long)offset + 1)));
+                    Array.Copy(byOffset, grown, byOffset.Length);
+                    _vertexByOffset[table] = byOffset = grown;
+                    _lastTable = ulong.MaxValue;
+                }
+                if (byOffset[offset] >= 0) return; // duplicate row
+                byOffset[offset] = _vertexIds.Count;
+                _vertexIds.Add(new InternalId(table, offset));
+            }
+
+            private int Lookup(ulong table, ulong offset)
+            {
+                // Rel results are usually grouped by table, so remember the last table's map.
+                if (table != _lastTable)
+                {
+                    if (!_vertexByOffset.TryGetValue(table, out _lastByOffset)) _lastByOffset = null;
+                    _lastTable = table;
+                }
+                if (_lastByOffset == null || offset >= (ulong)_lastByOffset.Length) return -1;
+                return _lastByOffset[offset];
+            }
+
+            private void AddEdge(int from, int to)
+            {
+                if (_edgeCount == _sources.Length)
+                {
+                    _sources = Grow(_sources, _edgeCount);
+                    _targets = Grow(_targets, _edgeCount);
+                }
+                _sources[_edgeCount] = from;
+                _targets[_edgeCount] = to;
+                _edgeCount++;
+            }
+
+            private static int[] Grow(int[] buffer, int count)
+            {
+                if (count == int.MaxValue) throw new KuzuException($"Projection cannot hold more than {int.MaxValue} rels");
+                var grown = ArrayPool<int>.Shared.Rent((int)Math.Min(int.MaxValue, (long)buffer.Length * 2));
+                Array.Copy(buffer, grown, count);
+                ArrayPool<int>.Shared.Return(buffer);
+                return grown;
+            }
+
+            private static int[] NewOffsetMap(int length)
+            {
+                var map = new int[length];
+                map.AsSpan().Fill(-1);
+                return map;
+            }
+
+            /// <summary>
+            /// Resolves an INTERNAL_ID column (a struct of offset and table) or a NODE column (a struct holding one in _ID).
+            /// </summary>
+            private static ArrowColumn IdColumn(ArrowColumn column, string role)
+            {
+                if (column.Format == "+s")
+                {
+                    if (column.ChildCount == 2 && FindChild(column, "offset") >= 0) return column;
+                    var id = FindChild(column, "_ID");
+                    if (id >= 0) return IdColumn(column.GetChild(id), role);
+                }
+                throw new KuzuException($"The {role} column '{column.Name}' must be a node or an INTERNAL_ID (use ID(n) in the query); its Arrow format is '{column.Format}'");
+            }
+
+            private static int OffsetChild(ArrowColumn id) => FindChild(id, "offset") == 1 ? 1 : 0;
+
+            private static int FindChild(ArrowColumn column, string name)
+            {
+                for (int i = 0; i < column.ChildCount; i++)
+                {
+                    if (string.Equals(column.GetChild(i).Name, name, StringComparison.OrdinalIgnoreCase)) return i;
+                }
+                return -1;
+            }
+        }
+    }
+}
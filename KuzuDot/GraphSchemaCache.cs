@@ -0,0 +1,169 @@
+using System;
+using System.Collections.Generic;
+using System.Collections.ObjectModel;
+using System.Text;
+using System.Threading;
+using KuzuDot.Native;
+using KuzuDot.Native.Enums;
+
+namespace KuzuDot
+{
+    /// <summary>
+    /// Property layout shared by every node or rel of one label within a result: interned names, their type ids and a
+    /// name-to-index map. Built once from the first element of the label.
+    /// </summary>
+    internal sealed class GraphElementSchema
+    {
+        private readonly Dictionary<string, int> _indexByName;
+
+        internal GraphElementSchema(string label, byte[] labelUtf8, string[] names, KuzuDataTypeId[] types)
+        {
+            Label = label;
+            LabelUtf8 = labelUtf8;
+            Names = new ReadOnlyCollection<string>(names);
+            Types = types;
+            _indexByName = new Dictionary<string, int>(names.Length, StringComparer.Ordinal);
+            for (int i = 0; i < names.Length; i++) _indexByName[names[i]] = i;
+        }
+
+        internal string Label { get; }
+        internal byte[] LabelUtf8 { get; }
+        internal ReadOnlyCollection<string> Names { get; }
+        internal KuzuDataTypeId[] Types { get; }
+
+        internal int IndexOf(string name) => name != null && _indexByName.TryGetValue(name, out var i) ? i : -1;
+    }
+
+    /// <summary>
+    /// Per-<see cref="QueryResult"/> cache of <see cref="GraphElementSchema"/>s keyed by label and property count, used by
+    /// <see cref="KuzuValue.ReadNode"/>/<see cref="KuzuValue.ReadRel"/> and their <see cref="KuzuDataReader"/> counterparts.
+    /// A hit compares the label's native UTF-8 bytes in place, so reading an element of a known label allocates no strings
+    /// except for its string-typed property values.
+    /// </summary>
+    internal sealed class GraphSchemaCache
+    {
+        private readonly object _lockObject = new object();
+        private readonly Dictionary<string, string> _names = new Dictionary<string, string>(StringComparer.Ordinal);
+        private GraphElementSchema[] _nodes = Array.Empty<GraphElementSchema>();
+        private GraphElementSchema[] _rels = Array.Empty<GraphElementSchema>();
+
+        internal unsafe KuzuNode ReadNode(IntPtr node)
+        {
+            if (NativeMethods.kuzu_value_is_null(node)) throw new KuzuException("Cannot read a NULL node value");
+            Check(NativeMethods.kuzu_node_val_get_id_val(node, out var idValue), "node id");
+            Check(NativeMethods.kuzu_value_get_internal_id((IntPtr)(&idValue), out var id), "node id");
+            var schema = ResolveNode(node);
+            var values = new object[schema.Types.Length];
+            for (int i = 0; i < values.Length; i++)
+            {
+                Check(NativeMethods.kuzu_node_val_get_property_value_at(node, (ulong)i, out var property), "node property value");
+                values[i] = ValueDecoder.Decode((IntPtr)(&property), schema.Types[i]);
+            }
+            return new KuzuNode(new InternalId(id), schema, values);
+        }
+
+        internal unsafe KuzuRel ReadRel(IntPtr rel)
+        {
+            if (NativeMethods.kuzu_value_is_null(rel)) throw new KuzuException("Cannot read a NULL rel value");
+            Check(NativeMethods.kuzu_rel_val_get_id_val(rel, out var idValue), "rel id");
+            Check(NativeMethods.kuzu_value_get_internal_id((IntPtr)(&idValue), out var id), "rel id");
+            Check(NativeMethods.kuzu_rel_val_get_src_id_val(rel, out var srcValue), "rel source id");
+            Check(NativeMethods.kuzu_value_get_internal_id((IntPtr)(&srcValue), out var src), "rel source id");
+            Check(NativeMethods.kuzu_rel_val_get_dst_id_val(rel, out var dstValue), "rel destination id");
+            Check(NativeMethods.kuzu_value_get_internal_id((IntPtr)(&dstValue), out var dst), "rel destination id");
+            var schema = ResolveRel(rel);
+            var values = new object[schema.Types.Length];
+            for (int i = 0; i < values.Length; i++)
+            {
+                Check(NativeMethods.kuzu_rel_val_get_property_value_at(rel, (ulong)i, out var property), "rel property value");
+                values[i] = ValueDecoder.Decode((IntPtr)(&property), schema.Types[i]);
+            }
+            return new KuzuRel(new InternalId(id), new InternalId(src), new InternalId(dst), schema, values);
+        }
+
+        /// <summary>Looks up (or builds) a node's schema from its label and property count only, decoding no values.</summary>
+        internal unsafe GraphElementSchema ResolveNode(IntPtr node)
+        {
+            Check(NativeMethods.kuzu_node_val_get_label_val(node, out var labelValue), "node label");
+            Check(NativeMethods.kuzu_node_val_get_property_size(node, out var count), "node property count");
+            return Resolve(ref _nodes, node, (IntPtr)(&labelValue), (int)count, isRel: false);
+        }
+
+        internal unsafe GraphElementSchema ResolveRel(IntPtr rel)
+        {
+            Check(NativeMethods.kuzu_rel_val_get_label_val(rel, out var labelValue), "rel label");
+            Check(NativeMethods.kuzu_rel_val_get_property_size(rel, out var count), "rel property count");
+            return Resolve(ref _rels, rel, (IntPtr)(&labelValue), (int)count, isRel: true);
+        }
+
+        /// <summary>Decodes the single property at <paramref name="index"/> of a node or rel with a resolved schema.</summary>
+        internal static unsafe object ReadProperty(IntPtr element, GraphElementSchema schema, int index, bool isRel)
+        {
+            KuzuDot.Native.KuzuValue property;
+            Check(isRel
+                ? NativeMethods.kuzu_rel_val_get_property_value_at(element, (ulong)index, out property)
+                : NativeMethods.kuzu_node_val_get_property_value_at(element, (ulong)index, out property), "property value");
+            return ValueDecoder.Decode((IntPtr)(&property), schema.Types[index]);
+        }
+
+        private GraphElementSchema Resolve(ref GraphElementSchema[] schemas, IntPtr element, IntPtr labelValue, int count, bool isRel)
+        {
+            Check(NativeMethods.kuzu_value_get_string(labelValue, out var labelPtr), "label");
+            try
+            {
+                var label = NativeUtil.Utf8Span(labelPtr);
+                foreach (var schema in Volatile.Read(ref schemas))
+                {
+                    if (schema.Types.Length == count && label.SequenceEqual(new ReadOnlySpan<byte>(schema.LabelUtf8))) return schema;
+                }
+                lock (_lockObject)
+                {
+                    foreach (var schema in schemas)
+                    {
+                        if (schema.Types.Length == count && label.SequenceEqual(new ReadOnlySpan<byte>(schema.LabelUtf8))) return schema;
+                    }
+                    var created = Build(element, label.ToArray(), count, isRel);
+                    var grown = new GraphElementSchema[schemas.Length + 1];
+                    Array.Copy(schemas, grown, schemas.Length);
+                    grown[schemas.Length] = created;
+                    Volatile.Write(ref schemas, grown);
+                    return created;
+                }
+            }
+            finally { if (labelPtr != IntPtr.Zero) NativeMethods.kuzu_destroy_string(labelPtr); }
+        }
+
+        private unsafe GraphElementSchema Build(IntPtr element, byte[] labelUtf8, int count, bool isRel)
+        {
+            var names = new string[count];
+            var types = new KuzuDataTypeId[count];
+            for (int i = 0; i < count; i++)
+            {
+                IntPtr namePtr;
+                KuzuDot.Native.KuzuValue property;
+                Check(isRel
+                    ? NativeMethods.kuzu_rel_val_get_property_name_at(element, (ulong)i, out namePtr)
+                    : NativeMethods.kuzu_node_val_get_property_name_at(element, (ulong)i, out namePtr), "property name");
+                names[i] = Intern(NativeUtil.PtrToStringAndDestroy(namePtr, NativeMethods.kuzu_destroy_string) ?? string.Empty);
+                Check(isRel
+                    ? NativeMethods.kuzu_rel_val_get_property_value_at(element, (ulong)i, out property)
+                    : NativeMethods.kuzu_node_val_get_property_value_at(element, (ulong)i, out property), "property value");
+                types[i] = ValueDecoder.GetTypeId((IntPtr)(&property));
+            }
+            return new GraphElementSchema(Intern(Encoding.UTF8.GetString(labelUtf8)), labelUtf8, names, types);
+        }
+
+        /// <summary>Shares one string instance per distinct name across all labels of the result.</summary>
+        private string Intern(string name)
+        {
+            if (_names.TryGetValue(name, out var existing)) return existing;
+            _names[name] = name;
+            return name;
+        }
+
+        private static void Check(KuzuState state, string what)
+        {
+            if (state != KuzuState.Success) throw new KuzuException($"Failed to get {what} - value is not a node/rel or is invalid");
+        }
+    }
+}
@@ -0,0 +1,288 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Threading;
+using System.Threading.Tasks;
+using KuzuDot.Utils;
+
+namespace KuzuDot
+{
+    public sealed class KuzuConnectionPoolOptions
+    {
+        /// <summary>Connections opened up front and kept open regardless of <see cref="IdleTimeout"/>.</summary>
+        public int MinSize { get; set; }
+        /// <summary>Maximum number of connections (idle + leased).</summary>
+        public int MaxSize { get; set; } = Environment.ProcessorCount * 2;
+        /// <summary>Idle connections above <see cref="MinSize"/> are closed after this long without use.</summary>
+        public TimeSpan IdleTimeout { get; set; } = TimeSpan.FromMinutes(5);
+        /// <summary>How long <c>Rent</c> waits for a free connection before throwing <see cref="TimeoutException"/>.</summary>
+        public TimeSpan AcquireTimeout { get; set; } = TimeSpan.FromSeconds(30);
+        /// <summary>Runs <see cref="HealthCheckQuery"/> before handing out an idle connection and replaces it on failure.</summary>
+        public bool ValidateOnRent { get; set; }
+        public string HealthCheckQuery { get; set; } = "RETURN 1;";
+        /// <summary>Applied to every new connection when non-zero.</summary>
+        public ulong MaxNumThreadsForExecution { get; set; }
+        /// <summary>Applied to every new connection through <see cref="Connection.SetQueryTimeout"/> when non-zero.</summary>
+        public ulong QueryTimeoutMs { get; set; }
+        /// <summary>Capacity of each connection's prepared-statement cache; 0 leaves caching disabled.</summary>
+        public int PreparedStatementCacheCapacity { get; set; }
+
+        internal void Validate()
+        {
+            if (MaxSize <= 0) throw new ArgumentOutOfRangeException(nameof(MaxSize), "MaxSize must be positive");
+            if (MinSize < 0 || MinSize > MaxSize) throw new ArgumentOutOfRangeException(nameof(MinSize), "MinSize must be between 0 and MaxSize");
+            if (IdleTimeout <= TimeSpan.Zero) throw new ArgumentOutOfRangeException(nameof(IdleTimeout), "IdleTimeout must be positive");
+            if (PreparedStatementCacheCapacity < 0) throw new ArgumentOutOfRangeException(nameof(PreparedStatementCacheCapacity), "PreparedStatementCacheCapacity cannot be negative");
+            if (ValidateOnRent) KuzuGuard.NotNullOrEmpty(HealthCheckQuery, nameof(HealthCheckQuery));
+        }
+
+        public override string ToString() => $"KuzuConnectionPoolOptions(Min={MinSize}, Max={MaxSize}, IdleTimeout={IdleTimeout})";
+    }
+
+    /// <summary>
+    /// Pool of <see cref="Connection"/>s over a single <see cref="Database"/>. Connections are reused across leases,
+    /// so per-connection settings and state survive between requests. A thread is preferentially handed the idle
+    /// connection it returned last.
+    /// </summary>
+    public sealed class KuzuConnectionPool : IDisposable
+    {
+        internal sealed class Entry
+        {
+            internal readonly Connection Connection;
+            internal int LastThreadId;
+            internal long LastUsedTimestamp;
+            internal Entry(Connection connection) { Connection = connection; }
+        }
+
+        private readonly Database _database;
+        private readonly KuzuConnectionPoolOptions _options;
+        private readonly SemaphoreSlim _leases;
+        private readonly List<Entry> _idle = new List<Entry>(); // ordered by return time, most recent last
+        private readonly object _lockObject = new object();
+        private readonly Timer _evictionTimer;
+        private int _count;
+        private bool _disposed;
+
+        internal KuzuConnectionPool(Database database, KuzuConnectionPoolOptions options)
+        {
+            KuzuGuard.NotNull(database, nameof(database));
+            KuzuGuard.NotNull(options, nameof(options));
+            options.Validate();
+            _database = database;
+            _options = options;
+            _leases = new SemaphoreSlim(options.MaxSize, options.MaxSize);
+            try
+            {
+                for (int i = 0; i < options.MinSize; i++)
+                {
+                    var entry = CreateEntry();
+                    entry.LastUsedTimestamp = Stopwatch.GetTimestamp();
+                    _idle.Add(entry);
+                }
+            }
+            catch
+            {
+                foreach (var entry in _idle) Destroy(entry);
+                _idle.Clear();
+                throw;
+            }
+            var period = TimeSpan.FromTicks(Math.Max(TimeSpan.TicksPerSecond, options.IdleTimeout.Ticks / 2));
+            // The timer only holds the pool weakly, so a pool that is dropped without Dispose can still be collected.
+            _evictionTimer = new Timer(OnEvictionTimer, new WeakReference<KuzuConnectionPool>(this), period, period);
+        }
+
+        /// <summary>Number of open connections, idle or leased.</summary>
+        public int Count => Volatile.Read(ref _count);
+
+        /// <summary>Number of open connections waiting in the pool.</summary>
+        public int IdleCount { get { lock (_lockObject) return _idle.Count; } }
+
+        /// <summary>
+        /// Leases a connection, waiting up to <see cref="KuzuConnectionPoolOptions.AcquireTimeout"/> for one to become available.
+        /// Dispose the lease to return the connection; a transaction still active on it is rolled back first, and the
+        /// connection is closed instead of reused if that rollback fails.
+        /// </summary>
+        /// <exception cref="TimeoutException">Thrown when no connection became available in time.</exception>
+        public PooledConnection Rent(CancellationToken cancellationToken = default)
+        {
+            ThrowIfDisposed();
+            if (!_leases.Wait(_options.AcquireTimeout, cancellationToken)) throw AcquireTimeout();
+            return Acquire();
+        }
+
+        /// <summary>
+        /// Leases a connection without blocking the calling thread while the pool is exhausted.
+        /// </summary>
+        /// <exception cref="TimeoutException">Thrown when no connection became available in time.</exception>
+        public async Task<PooledConnection> RentAsync(CancellationToken cancellationToken = default)
+        {
+            ThrowIfDisposed();
+            if (!await _leases.WaitAsync(_options.AcquireTimeout, cancellationToken).ConfigureAwait(false)) throw AcquireTimeout();
+            return Acquire();
+        }
+
+        private PooledConnection Acquire()
+        {
+            try
+            {
+                while (true)
+                {
+                    var entry = TakeIdle();
+                    if (entry == null) return new PooledConnection(this, CreateEntry());
+                    if (!_options.ValidateOnRent || IsHealthy(entry.Connection)) return new PooledConnection(this, entry);
+                    Destroy(entry);
+                }
+            }
+            catch
+            {
+                _leases.Release();
+                throw;
+            }
+        }
+
+        private Entry TakeIdle()
+        {
+            lock (_lockObject)
+            {
+                ThrowIfDisposed();
+                if (_idle.Count == 0) return null;
+                var threadId = Environment.CurrentManagedThreadId;
+                int index = _idle.Count - 1;
+                for (int i = index; i >= 0; i--)
+                {
+                    if (_idle[i].LastThreadId == threadId) { index = i; break; }
+                }
+                var entry = _idle[index];
+                _idle.RemoveAt(index);
+                return entry;
+            }
+        }
+
+        internal void Return(Entry entry)
+        {
+            entry.LastThreadId = Environment.CurrentManagedThreadId;
+            entry.LastUsedTimestamp = Stopwatch.GetTimestamp();
+            // A transaction left open by the lease would otherwise capture the next renter's statements.
+            var clean = entry.Connection.CurrentTransaction?.TryAbandon() ?? true;
+            bool keep;
+            lock (_lockObject)
+            {
+                keep = clean && !_disposed && !entry.Connection.IsDisposed;
+                if (keep) _idle.Add(entry);
+            }
+            if (!keep) Destroy(entry);
+            _leases.Release();
+        }
+
+        private Entry CreateEntry()
+        {
+            var connection = _database.Connect();
+            try
+            {
+                if (_options.MaxNumThreadsForExecution != 0) connection.MaxNumThreadsForExecution = _options.MaxNumThreadsForExecution;
+                if (_options.QueryTimeoutMs != 0) connection.SetQueryTimeout(_options.QueryTimeoutMs);
+                if (_options.PreparedStatementCacheCapacity != 0) connection.EnablePreparedStatementCache(_options.PreparedStatementCacheCapacity);
+            }
+            catch
+            {
+                connection.Dispose();
+                throw;
+            }
+            Interlocked.Increment(ref _count);
+            return new Entry(connection);
+        }
+
+        private void Destroy(Entry entry)
+        {
+            Interlocked.Decrement(ref _count);
+            entry.Connection.Dispose();
+        }
+
+        private bool IsHealthy(Connection connection)
+        {
+            try
+            {
+                connection.Query(_options.HealthCheckQuery).Dispose();
+                return true;
+            }
+            catch (KuzuException) { return false; }
+            catch (ObjectDisposedException) { return false; }
+        }
+
+        private static void OnEvictionTimer(object state)
+        {
+            if (((WeakReference<KuzuConnectionPool>)state).TryGetTarget(out var pool)) pool.EvictIdle();
+        }
+
+        private void EvictIdle()
+        {
+            List<Entry> expired = null;
+            var cutoff = Stopwatch.GetTimestamp() - (long)(_options.IdleTimeout.TotalSeconds * Stopwatch.Frequency);
+            lock (_lockObject)
+            {
+                if (_disposed) return;
+                int i = 0;
+                while (i < _idle.Count && Count - (expired?.Count ?? 0) > _options.MinSize && _idle[i].LastUsedTimestamp < cutoff)
+                {
+                    (expired ??= new List<Entry>()).Add(_idle[i]);
+                    i++;
+                }
+                if (i > 0) _idle.RemoveRange(0, i);
+            }
+            if (expired == null) return;
+            foreach (var entry in expired) Destroy(entry);
+        }
+
+        private TimeoutException AcquireTimeout() => new TimeoutException($"No pooled connection became available within {_options.AcquireTimeout}");
+
+        private void ThrowIfDisposed() { if (_disposed) throw new ObjectDisposedException(nameof(KuzuConnectionPool)); }
+
+        public override string ToString() => _disposed ? "KuzuConnectionPool(Disposed)" : $"KuzuConnectionPool(Count={Count}, Idle={IdleCount}, Max={_options.MaxSize})";
+
+        /// <summary>
+        /// Closes all idle connections. Leased connections are closed as their leases are returned.
+        /// </summary>
+        public void Dispose()
+        {
+            Entry[] idle;
+            lock (_lockObject)
+            {
+                if (_disposed) return;
+                _disposed = true;
+                idle = _idle.ToArray();
+                _idle.Clear();
+            }
+            _evictionTimer.Dispose();
+            foreach (var entry in idle) Destroy(entry);
+        }
+    }
+
+    /// <summary>
+    /// A leased <see cref="KuzuDot.Connection"/>. Disposing the lease returns the connection to its pool;
+    /// do not dispose the connection itself.
+    /// </summary>
+    public sealed class PooledConnection : IDisposable
+    {
+        private KuzuConnectionPool _pool;
+        private readonly KuzuConnectionPool.Entry _entry;
+
+        internal PooledConnection(KuzuConnectionPool pool, KuzuConnectionPool.Entry entry)
+        {
+            _pool = pool;
+            _entry = entry;
+        }
+
+        public Connection Connection
+        {
+            get
+            {
+                if (Volatile.Read(ref _pool) == null) throw new ObjectDisposedException(nameof(PooledConnection));
+                return _entry.Connection;
+            }
+        }
+
+        public override string ToString() => Volatile.Read(ref _pool) == null ? "PooledConnection(Returned)" : "PooledConnection(" + _entry.Connection + ")";
+
+        public void Dispose() { Interlocked.Exchange(ref _pool, null)?.Return(_entry); }
+    }
+}
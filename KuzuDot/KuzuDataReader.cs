@@ -0,0 +1,324 @@
+using System;
+using System.Runtime.CompilerServices;
+using KuzuDot.Native;
+using KuzuDot.Native.Enums;
+
+namespace KuzuDot
+{
+    /// <summary>
+    /// Forward-only, allocation-free row cursor over a <see cref="QueryResult"/>.
+    /// Column count and types are resolved once when the cursor is created and the engine's
+    /// tuple is reused across <see cref="Read"/> calls, so iterating does not create a
+    /// <see cref="FlatTuple"/> (or any SafeHandle) per row.
+    /// </summary>
+    /// <remarks>
+    /// This is a mutable struct: keep it in a local variable (not a readonly field) and do not copy it
+    /// while iterating. Cell data belongs to the current row and is overwritten by the next <see cref="Read"/>.
+    /// </remarks>
+    public struct KuzuDataReader
+    {
+        private readonly QueryResult _result;
+        private readonly KuzuDataTypeId[] _columnTypes;
+        private KuzuFlatTuple _tuple;
+        private bool _hasRow;
+
+        internal KuzuDataReader(QueryResult result)
+        {
+            _result = result;
+            _columnTypes = result.ColumnTypeIds;
+            _tuple = default;
+            _hasRow = false;
+        }
+
+        /// <summary>Number of columns in each row.</summary>
+        public int FieldCount => _columnTypes?.Length ?? 0;
+
+        /// <summary>True when the cursor is positioned on a row.</summary>
+        public bool HasRow => _hasRow;
+
+        /// <summary>
+        /// Advances to the next row.
+        /// </summary>
+        /// <returns>False once all tuples have been consumed.</returns>
+        public bool Read()
+        {
+            if (_result == null) throw new InvalidOperationException("Reader is not attached to a query result");
+            _hasRow = _result.TryReadNext(ref _tuple);
+            return _hasRow;
+        }
+
+        /// <summary>Gets the name of the column at the specified ordinal.</summary>
+        public string GetName(int ordinal)
+        {
+            CheckOrdinal(ordinal);
+            return _result.ColumnNames[ordinal];
+        }
+
+        /// <summary>Gets the ordinal of the column with the specified name (case-insensitive), or -1 if not found.</summary>
+        public int GetOrdinal(string name)
+        {
+            if (name == null) throw new ArgumentNullException(nameof(name));
+            var names = _result.ColumnNames;
+            for (int i = 0; i < names.Length; i++) if (string.Equals(names[i], name, StringComparison.Ordinal)) return i;
+            for (int i = 0; i < names.Length; i++) if (string.Equals(names[i], name, StringComparison.OrdinalIgnoreCase)) return i;
+            return -1;
+        }
+
+        /// <summary>Gets the CLR type that the typed accessors return for the column at the specified ordinal.</summary>
+        public Type GetFieldType(int ordinal)
+        {
+            CheckOrdinal(ordinal);
+            return MapClrType(_columnTypes[ordinal]);
+        }
+
+        internal KuzuDataTypeId GetColumnTypeId(int ordinal)
+        {
+            CheckOrdinal(ordinal);
+            return _columnTypes[ordinal];
+        }
+
+        /// <summary>Returns true if the value at the specified ordinal of the current row is null.</summary>
+        public unsafe bool IsNull(int ordinal)
+        {
+            var cell = GetCell(ordinal);
+            return NativeMethods.kuzu_value_is_null((IntPtr)(&cell));
+        }
+
+        /// <summary>
+        /// Gets the value at the specified ordinal as a <see cref="KuzuValue"/> wrapper.
+        /// This allocates; prefer the typed accessors in hot loops. The returned value is only valid until the next <see cref="Read"/>.
+        /// </summary>
+        public KuzuValue GetValue(int ordinal) => KuzuValue.CreateBorrowedFromRaw(GetCell(ordinal));
+
+        // Typed accessors: read straight from the borrowed native value (no KuzuValue wrapper, no HGlobal, no lock).
+        public unsafe bool GetBool(int ordinal) { var cell = GetCell(ordinal); if (NativeMethods.kuzu_value_get_bool((IntPtr)(&cell), out var v) != KuzuState.Success) throw TypeMismatch(ordinal, "boolean"); return v; }
+        public unsafe sbyte GetInt8(int ordinal) { var cell = GetCell(ordinal); if (NativeMethods.kuzu_value_get_int8((IntPtr)(&cell), out var v) != KuzuState.Success) throw TypeMismatch(ordinal, "int8"); return v; }
+        public unsafe short GetInt16(int ordinal) { var cell = GetCell(ordinal); if (NativeMethods.kuzu_value_get_int16((IntPtr)(&cell), out var v) != KuzuState.Success) throw TypeMismatch(ordinal, "int16"); return v; }
+        public unsafe int GetInt32(int ordinal) { var cell = GetCell(ordinal); if (NativeMethods.kuzu_value_get_int32((IntPtr)(&cell), out var v) != KuzuState.Success) throw TypeMismatch(ordinal, "int32"); return v; }
+        public unsafe long GetInt64(int ordinal) { var cell = GetCell(ordinal); if (NativeMethods.kuzu_value_get_int64((IntPtr)(&cell), out var v) != KuzuState.Success) throw TypeMismatch(ordinal, "int64"); return v; }
+        public unsafe byte GetUInt8(int ordinal) { var cell = GetCell(ordinal); if (NativeMethods.kuzu_value_get_uint8((IntPtr)(&cell), out var v) != KuzuState.Success) throw TypeMismatch(ordinal, "uint8"); return v; }
+        public unsafe ushort GetUInt16(int ordinal) { var cell = GetCell(ordinal); if (NativeMethods.kuzu_value_get_uint16((IntPtr)(&cell), out var v) != KuzuState.Success) throw TypeMismatch(ordinal, "uint16"); return v; }
+        public unsafe uint GetUInt32(int ordinal) { var cell = GetCell(ordinal); if (NativeMethods.kuzu_value_get_uint32((IntPtr)(&cell), out var v) != KuzuState.Success) throw TypeMismatch(ordinal, "uint32"); return v; }
+        public unsafe ulong GetUInt64(int ordinal) { var cell = GetCell(ordinal); if (NativeMethods.kuzu_value_get_uint64((IntPtr)(&cell), out var v) != KuzuState.Success) throw TypeMismatch(ordinal, "uint64"); return v; }
+        public unsafe float GetFloat(int ordinal) { var cell = GetCell(ordinal); if (NativeMethods.kuzu_value_get_float((IntPtr)(&cell), out var v) != KuzuState.Success) throw TypeMismatch(ordinal, "float"); return v; }
+        public unsafe double GetDouble(int ordinal) { var cell = GetCell(ordinal); if (NativeMethods.kuzu_value_get_double((IntPtr)(&cell), out var v) != KuzuState.Success) throw TypeMismatch(ordinal, "double"); return v; }
+        public unsafe InternalId GetInternalId(int ordinal) { var cell = GetCell(ordinal); if (NativeMethods.kuzu_value_get_internal_id((IntPtr)(&cell), out var v) != KuzuState.Success) throw TypeMismatch(ordinal, "internal id"); return new InternalId(v); }
+        public unsafe TimeSpan GetInterval(int ordinal) { var cell = GetCell(ordinal); if (NativeMethods.kuzu_value_get_interval((IntPtr)(&cell), out var v) != KuzuState.Success) throw TypeMismatch(ordinal, "interval"); return DateTimeUtilities.NativeIntervalToTimeSpan(v); }
+        public unsafe System.Numerics.BigInteger GetBigInteger(int ordinal) { var cell = GetCell(ordinal); if (NativeMethods.kuzu_value_get_int128((IntPtr)(&cell), out var v) != KuzuState.Success) throw TypeMismatch(ordinal, "int128"); return Int128Utilities.ToBigInteger(v); }
+
+        /// <summary>
+        /// Gets a DATE or TIMESTAMP (any precision) column as a UTC <see cref="DateTime"/>. The native getter is chosen from the cached column type.
+        /// </summary>
+        public unsafe DateTime GetDateTime(int ordinal)
+        {
+            var cell = GetCell(ordinal);
+            var ptr = (IntPtr)(&cell);
+            switch (_columnTypes[ordinal])
+            {
+                case KuzuDataTypeId.Date:
+                    if (NativeMethods.kuzu_value_get_date(ptr, out var d) != KuzuState.Success) break;
+                    return DateTimeUtilities.KuzuDateToDateTime(d);
+                case KuzuDataTypeId.TimestampNs:
+                    if (NativeMethods.kuzu_value_get_timestamp_ns(ptr, out var ns) != KuzuState.Success) break;
+                    return DateTimeUtilities.UnixMicrosecondsToDateTime(ns.Value / 1000);
+                case KuzuDataTypeId.TimestampMs:
+                    if (NativeMethods.kuzu_value_get_timestamp_ms(ptr, out var ms) != KuzuState.Success) break;
+                    return DateTimeUtilities.UnixMicrosecondsToDateTime(ms.Value * 1000);
+                case KuzuDataTypeId.TimestampSec:
+                    if (NativeMethods.kuzu_value_get_timestamp_sec(ptr, out var sec) != KuzuState.Success) break;
+                    return DateTimeUtilities.UnixMicrosecondsToDateTime(sec.Value * 1_000_000);
+                case KuzuDataTypeId.TimestampTz:
+                    if (NativeMethods.kuzu_value_get_timestamp_tz(ptr, out var tz) != KuzuState.Success) break;
+                    return DateTimeUtilities.UnixMicrosecondsToDateTime(tz.Value);
+                default:
+                    if (NativeMethods.kuzu_value_get_timestamp(ptr, out var ts) != KuzuState.Success) break;
+                    return DateTimeUtilities.NativeTimestampToDateTime(ts);
+            }
+            throw TypeMismatch(ordinal, "date/timestamp");
+        }
+
+        /// <summary>
+        /// Gets a STRING, DECIMAL or UUID column as a managed string. The native getter is chosen from the cached column type.
+        /// </summary>
+        public string GetString(int ordinal)
+        {
+            var str = GetNativeString(ordinal);
+            if (str == IntPtr.Zero) return string.Empty;
+            try { return NativeUtil.PtrToStringUtf8(str) ?? string.Empty; }
+            finally { NativeMethods.kuzu_destroy_string(str); }
+        }
+
+        /// <summary>
+        /// Gets a STRING, DECIMAL or UUID column as its raw UTF-8 bytes (without a terminator), avoiding the UTF-16 string.
+        /// The span points at native memory that stays valid until the next <see cref="GetStringUtf8"/> or <see cref="Read"/>
+        /// call on this result, or until the result is disposed.
+        /// </summary>
+        public ReadOnlySpan<byte> GetStringUtf8(int ordinal)
+        {
+            var str = GetNativeString(ordinal);
+            _result.SetUtf8Scratch(str);
+            return NativeUtil.Utf8Span(str);
+        }
+
+        /// <summary>Gets a BLOB column as a new array, decoded in a single pass from the engine's text form.</summary>
+        public byte[] GetBlob(int ordinal)
+        {
+            var text = GetBlobText(ordinal);
+            try { return BlobCodec.Decode(NativeUtil.Utf8Span(text)); }
+            finally { if (text != IntPtr.Zero) NativeMethods.kuzu_destroy_string(text); }
+        }
+
+        /// <summary>
+        /// Copies a BLOB column into <paramref name="destination"/> (for example a pooled buffer) and returns the number of
+        /// bytes written. Use <see cref="GetBlobLength"/> to size the buffer.
+        /// </summary>
+        /// <exception cref="ArgumentException"><paramref name="destination"/> is too small.</exception>
+        public int GetBlob(int ordinal, Span<byte> destination)
+        {
+            var text = GetBlobText(ordinal);
+            try
+            {
+                var span = NativeUtil.Utf8Span(text);
+                var length = BlobCodec.GetDecodedLength(span);
+                if (destination.Length < length) throw new ArgumentException($"Destination is too small for a {length}-byte blob", nameof(destination));
+                return BlobCodec.Decode(span, destination);
+            }
+            finally { if (text != IntPtr.Zero) NativeMethods.kuzu_destroy_string(text); }
+        }
+
+        /// <summary>Gets the size in bytes of a BLOB column.</summary>
+        public int GetBlobLength(int ordinal)
+        {
+            var text = GetBlobText(ordinal);
+            try { return BlobCodec.GetDecodedLength(NativeUtil.Utf8Span(text)); }
+            finally { if (text != IntPtr.Zero) NativeMethods.kuzu_destroy_string(text); }
+        }
+
+        /// <summary>
+        /// Gets the engine's escaped text form of a BLOB cell (free with <c>kuzu_destroy_string</c>). <c>kuzu_value_get_blob</c>
+        /// is not used because its NUL-terminated buffer truncates blobs at the first zero byte.
+        /// </summary>
+        private unsafe IntPtr GetBlobText(int ordinal)
+        {
+            var cell = GetCell(ordinal);
+            if (_columnTypes[ordinal] != KuzuDataTypeId.Blob) throw TypeMismatch(ordinal, "blob");
+            var text = NativeMethods.kuzu_value_to_string((IntPtr)(&cell));
+            if (text == IntPtr.Zero) throw TypeMismatch(ordinal, "blob");
+            return text;
+        }
+
+        private unsafe IntPtr GetNativeString(int ordinal)
+        {
+            var cell = GetCell(ordinal);
+            var ptr = (IntPtr)(&cell);
+            KuzuState state;
+            IntPtr str;
+            switch (_columnTypes[ordinal])
+            {
+                case KuzuDataTypeId.Decimal: state = NativeMethods.kuzu_value_get_decimal_as_string(ptr, out str); break;
+                case KuzuDataTypeId.Uuid: state = NativeMethods.kuzu_value_get_uuid(ptr, out str); break;
+                default: state = NativeMethods.kuzu_value_get_string(ptr, out str); break;
+            }
+            if (state != KuzuState.Success) throw TypeMismatch(ordinal, "string");
+            return str;
+        }
+
+        /// <summary>
+        /// Decodes a NODE column's id, label and properties in one pass. Property names are fetched once per label for the
+        /// whole result; see <see cref="KuzuNode"/>.
+        /// </summary>
+        public unsafe KuzuNode ReadNode(int ordinal) { var cell = GetCell(ordinal); return _result.GraphSchemas.ReadNode((IntPtr)(&cell)); }
+
+        /// <summary>Decodes a REL column's ids, label and properties in one pass; see <see cref="ReadNode"/>.</summary>
+        public unsafe KuzuRel ReadRel(int ordinal) { var cell = GetCell(ordinal); return _result.GraphSchemas.ReadRel((IntPtr)(&cell)); }
+
+        /// <summary>
+        /// Decodes a RECURSIVE_REL (path) column into contiguous node and rel id arrays; see <see cref="KuzuPath"/>.
+        /// </summary>
+        public unsafe KuzuPath ReadPath(int ordinal, bool includeProperties = false) { var cell = GetCell(ordinal); return KuzuPath.Read((IntPtr)(&cell), _result.GraphSchemas, includeProperties); }
+
+        /// <summary>
+        /// Gets a lazy view of a NODE column that decodes properties only when accessed by name or index; see
+        /// <see cref="KuzuNodeView"/>. The view is valid until the next <see cref="Read"/>.
+        /// </summary>
+        public unsafe KuzuNodeView GetNodeView(int ordinal)
+        {
+            var cell = GetCell(ordinal);
+            if (NativeMethods.kuzu_value_is_null((IntPtr)(&cell))) throw new KuzuException("Cannot read a NULL node value");
+            return new KuzuNodeView(_result, cell, _result.GraphSchemas.ResolveNode((IntPtr)(&cell)));
+        }
+
+        /// <summary>Gets a lazy view of a REL column; see <see cref="GetNodeView"/>.</summary>
+        public unsafe KuzuRelView GetRelView(int ordinal)
+        {
+            var cell = GetCell(ordinal);
+            if (NativeMethods.kuzu_value_is_null((IntPtr)(&cell))) throw new KuzuException("Cannot read a NULL rel value");
+            return new KuzuRelView(_result, cell, _result.GraphSchemas.ResolveRel((IntPtr)(&cell)));
+        }
+
+        /// <summary>Gets the engine's text form of any cell (used for nested and graph values that have no typed accessor).</summary>
+        internal unsafe string GetCellText(int ordinal)
+        {
+            var cell = GetCell(ordinal);
+            return NativeUtil.PtrToStringAndDestroy(NativeMethods.kuzu_value_to_string((IntPtr)(&cell)), NativeMethods.kuzu_destroy_string);
+        }
+
+        private KuzuException TypeMismatch(int ordinal, string name) => new KuzuException($"Failed to get {name} value at column {ordinal} - type mismatch or invalid value");
+
+        /// <summary>
+        /// Fetches the borrowed native value for a cell of the current row. The pointer inside is owned by the
+        /// engine's tuple; no managed wrapper or unmanaged allocation is created.
+        /// </summary>
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        internal KuzuDot.Native.KuzuValue GetCell(int ordinal)
+        {
+            CheckOrdinal(ordinal);
+            if (!_hasRow) throw new InvalidOperationException("No current row; call Read() first");
+            if (_result.IsDisposed) throw new ObjectDisposedException(nameof(QueryResult));
+            var state = NativeMethods.kuzu_flat_tuple_get_value(ref _tuple, (ulong)ordinal, out var cell);
+            if (state != KuzuState.Success || cell.Value == IntPtr.Zero) throw new KuzuException($"Failed to get value at index {ordinal}. Native result: {state}");
+            cell.IsOwnedByCpp = true;
+            return cell;
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        private void CheckOrdinal(int ordinal)
+        {
+            if (_columnTypes == null) throw new InvalidOperationException("Reader is not attached to a query result");
+            if ((uint)ordinal >= (uint)_columnTypes.Length) throw new ArgumentOutOfRangeException(nameof(ordinal), ordinal, $"Column ordinal must be between 0 and {_columnTypes.Length - 1}");
+        }
+
+        private static Type MapClrType(KuzuDataTypeId id)
+        {
+            switch (id)
+            {
+                case KuzuDataTypeId.Bool: return typeof(bool);
+                case KuzuDataTypeId.Int8: return typeof(sbyte);
+                case KuzuDataTypeId.Int16: return typeof(short);
+                case KuzuDataTypeId.Int32: return typeof(int);
+                case KuzuDataTypeId.Int64:
+                case KuzuDataTypeId.Serial: return typeof(long);
+                case KuzuDataTypeId.UInt8: return typeof(byte);
+                case KuzuDataTypeId.UInt16: return typeof(ushort);
+                case KuzuDataTypeId.UInt32: return typeof(uint);
+                case KuzuDataTypeId.UInt64: return typeof(ulong);
+                case KuzuDataTypeId.Int128: return typeof(System.Numerics.BigInteger);
+                case KuzuDataTypeId.Float: return typeof(float);
+                case KuzuDataTypeId.Double: return typeof(double);
+                case KuzuDataTypeId.Date:
+                case KuzuDataTypeId.Timestamp:
+                case KuzuDataTypeId.TimestampSec:
+                case KuzuDataTypeId.TimestampMs:
+                case KuzuDataTypeId.TimestampNs:
+                case KuzuDataTypeId.TimestampTz: return typeof(DateTime);
+                case KuzuDataTypeId.Interval: return typeof(TimeSpan);
+                case KuzuDataTypeId.InternalId: return typeof(InternalId);
+                case KuzuDataTypeId.String:
+                case KuzuDataTypeId.Decimal:
+                case KuzuDataTypeId.Uuid: return typeof(string);
+                case KuzuDataTypeId.Blob: return typeof(byte[]);
+                default: return typeof(KuzuValue);
+            }
+        }
+    }
+}
@@ -0,0 +1,118 @@
+using System;
+using KuzuDot.Native;
+using KuzuDot.Native.Enums;
+
+namespace KuzuDot
+{
+    /// <summary>
+    /// A path (RECURSIVE_REL value, e.g. from a variable-length or shortest-path pattern) decoded by
+    /// <see cref="KuzuValue.ReadPath"/> or <see cref="KuzuDataReader.ReadPath"/> into contiguous id arrays.
+    /// Node and rel properties are only decoded when requested at read time, since the native value belongs to
+    /// the current row and cannot be revisited afterwards.
+    /// </summary>
+    public readonly struct KuzuPath
+    {
+        private readonly InternalId[] _nodeIds;
+        private readonly InternalId[] _relIds;
+        private readonly InternalId[] _relSourceIds;
+        private readonly InternalId[] _relDestinationIds;
+        private readonly KuzuNode[] _nodes;
+        private readonly KuzuRel[] _rels;
+
+        private KuzuPath(InternalId[] nodeIds, InternalId[] relIds, InternalId[] relSourceIds, InternalId[] relDestinationIds, KuzuNode[] nodes, KuzuRel[] rels)
+        {
+            _nodeIds = nodeIds;
+            _relIds = relIds;
+            _relSourceIds = relSourceIds;
+            _relDestinationIds = relDestinationIds;
+            _nodes = nodes;
+            _rels = rels;
+        }
+
+        /// <summary>Number of rels (hops) in the path.</summary>
+        public int Length => _relIds?.Length ?? 0;
+
+        /// <summary>Ids of the path's node list as reported by the engine (for recursive rels, the nodes between the endpoints).</summary>
+        public ReadOnlySpan<InternalId> NodeIds => _nodeIds;
+        public ReadOnlySpan<InternalId> RelIds => _relIds;
+        /// <summary>Source node id of each rel, parallel to <see cref="RelIds"/>.</summary>
+        public ReadOnlySpan<InternalId> RelSourceIds => _relSourceIds;
+        /// <summary>Destination node id of each rel, parallel to <see cref="RelIds"/>.</summary>
+        public ReadOnlySpan<InternalId> RelDestinationIds => _relDestinationIds;
+
+        /// <summary>True when node and rel properties were decoded (<c>includeProperties</c> was set).</summary>
+        public bool HasProperties => _nodes != null;
+        /// <summary>Fully decoded nodes, parallel to <see cref="NodeIds"/>; empty unless <see cref="HasProperties"/>.</summary>
+        public ReadOnlySpan<KuzuNode> Nodes => _nodes;
+        /// <summary>Fully decoded rels, parallel to <see cref="RelIds"/>; empty unless <see cref="HasProperties"/>.</summary>
+        public ReadOnlySpan<KuzuRel> Rels => _rels;
+
+        public override string ToString() => $"KuzuPath(Nodes={_nodeIds?.Length ?? 0}, Rels={Length})";
+
+        /// <summary>
+        /// Walks the node and rel lists of a borrowed RECURSIVE_REL value with stack-held native structs: no
+        /// <see cref="KuzuValue"/> wrapper is created per element, and ids are read directly from each element.
+        /// </summary>
+        internal static unsafe KuzuPath Read(IntPtr path, GraphSchemaCache schemas, bool includeProperties)
+        {
+            if (NativeMethods.kuzu_value_is_null(path)) throw new KuzuException("Cannot read a NULL path value");
+            Check(NativeMethods.kuzu_value_get_recursive_rel_node_list(path, out var nodeList), "path node list");
+            Check(NativeMethods.kuzu_value_get_recursive_rel_rel_list(path, out var relList), "path rel list");
+            var nodesPtr = (IntPtr)(&nodeList);
+            var relsPtr = (IntPtr)(&relList);
+            Check(NativeMethods.kuzu_value_get_list_size(nodesPtr, out var nodeCount), "path node count");
+            Check(NativeMethods.kuzu_value_get_list_size(relsPtr, out var relCount), "path rel count");
+
+            var nodeIds = nodeCount == 0 ? Array.Empty<InternalId>() : new InternalId[nodeCount];
+            var nodes = includeProperties ? (nodeCount == 0 ? Array.Empty<KuzuNode>() : new KuzuNode[nodeCount]) : null;
+            for (int i = 0; i < nodeIds.Length; i++)
+            {
+                Check(NativeMethods.kuzu_value_get_list_element(nodesPtr, (ulong)i, out var element), "path node");
+                var elementPtr = (IntPtr)(&element);
+                if (nodes != null)
+                {
+                    nodes[i] = schemas.ReadNode(elementPtr);
+                    nodeIds[i] = nodes[i].Id;
+                    continue;
+                }
+                Check(NativeMethods.kuzu_node_val_get_id_val(elementPtr, out var idValue), "path node id");
+                Check(NativeMethods.kuzu_value_get_internal_id((IntPtr)(&idValue), out var id), "path node id");
+                nodeIds[i] = new InternalId(id);
+            }
+
+            var relIds = relCount == 0 ? Array.Empty<InternalId>() : new InternalId[relCount];
+            var sources = relCount == 0 ? Array.Empty<InternalId>() : new InternalId[relCount];
+            var destinations = relCount == 0 ? Array.Empty<InternalId>() : new InternalId[relCount];
+            var rels = includeProperties ? (relCount == 0 ? Array.Empty<KuzuRel>() : new KuzuRel[relCount]) : null;
+            for (int i = 0; i < relIds.Length; i++)
+            {
+                Check(NativeMethods.kuzu_value_get_list_element(relsPtr, (ulong)i, out var element), "path rel");
+                var elementPtr = (IntPtr)(&element);
+                if (rels != null)
+                {
+                    var rel = schemas.ReadRel(elementPtr);
+                    rels[i] = rel;
+                    relIds[i] = rel.Id;
+                    sources[i] = rel.SourceId;
+                    destinations[i] = rel.DestinationId;
+                    continue;
+                }
+                Check(NativeMethods.kuzu_rel_val_get_id_val(elementPtr, out var idValue), "path rel id");
+                Check(NativeMethods.kuzu_value_get_internal_id((IntPtr)(&idValue), out var id), "path rel id");
+                Check(NativeMethods.kuzu_rel_val_get_src_id_val(elementPtr, out var srcValue), "path rel source");
+                Check(NativeMethods.kuzu_value_get_internal_id((IntPtr)(&srcValue), out var src), "path rel source");
+                Check(NativeMethods.kuzu_rel_val_get_dst_id_val(elementPtr, out var dstValue), "path rel destination");
+                Check(NativeMethods.kuzu_value_get_internal_id((IntPtr)(&dstValue), out var dst), "path rel destination");
+                relIds[i] = new InternalId(id);
+                sources[i] = new InternalId(src);
+                destinations[i] = new InternalId(dst);
+            }
+            return new KuzuPath(nodeIds, relIds, sources, destinations, nodes, rels);
+        }
+
+        private static void Check(KuzuState state, string what)
+        {
+            if (state != KuzuState.Success) throw new KuzuException($"Failed to get {what} - value is not a path or is invalid");
+        }
+    }
+}
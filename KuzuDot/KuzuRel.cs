@@ -0,0 +1,67 @@
+using System;
+using System.Collections.Generic;
+using System.Text;
+
+namespace KuzuDot
+{
+    /// <summary>
+    /// A rel decoded in one pass by <see cref="KuzuValue.ReadRel"/> or <see cref="KuzuDataReader.ReadRel"/>: its id, endpoints,
+    /// label and property values as CLR objects (typed as in <see cref="KuzuDataReader.GetFieldType"/>; nested types as
+    /// text). The label and property names are shared by all rels of the label read from the same result.
+    /// </summary>
+    public readonly struct KuzuRel
+    {
+        private readonly GraphElementSchema _schema;
+        private readonly object[] _values;
+
+        internal KuzuRel(InternalId id, InternalId sourceId, InternalId destinationId, GraphElementSchema schema, object[] values)
+        {
+            Id = id;
+            SourceId = sourceId;
+            DestinationId = destinationId;
+            _schema = schema;
+            _values = values;
+        }
+
+        public InternalId Id { get; }
+        /// <summary>Id of the node the rel starts from.</summary>
+        public InternalId SourceId { get; }
+        /// <summary>Id of the node the rel points to.</summary>
+        public InternalId DestinationId { get; }
+        public string Label => _schema?.Label;
+        public int PropertyCount => _values?.Length ?? 0;
+        /// <summary>Property names in engine order; index <c>i</c> matches <see cref="GetProperty(int)"/>.</summary>
+        public IReadOnlyList<string> PropertyNames => (IReadOnlyList<string>)_schema?.Names ?? Array.Empty<string>();
+
+        /// <summary>Gets a property value by name; null when the property is NULL.</summary>
+        /// <exception cref="KeyNotFoundException">The rel has no property <paramref name="name"/>.</exception>
+        public object this[string name] => TryGetProperty(name, out var value) ? value : throw new KeyNotFoundException($"Rel '{Label}' has no property '{name}'");
+
+        public object GetProperty(int index)
+        {
+            if ((uint)index >= (uint)PropertyCount) throw new ArgumentOutOfRangeException(nameof(index));
+            return _values[index];
+        }
+
+        /// <summary>Gets a property value cast to <typeparamref name="T"/>; a NULL property yields <c>default</c>.</summary>
+        public T GetProperty<T>(string name)
+        {
+            var value = this[name];
+            return value == null ? default : (T)value;
+        }
+
+        public bool TryGetProperty(string name, out object value)
+        {
+            var index = _schema?.IndexOf(name) ?? -1;
+            value = index >= 0 ? _values[index] : null;
+            return index >= 0;
+        }
+
+        public override string ToString()
+        {
+            var sb = new StringBuilder("KuzuRel(").Append(Label).Append(", ").Append(SourceId).Append("->").Append(DestinationId);
+            for (int i = 0; i < PropertyCount; i++) sb.Append(", ").Append(_schema.Names[i]).Append('=').Append(_values[i]);
+            return sb.Append(')').ToString();
+        }
+    }
+}
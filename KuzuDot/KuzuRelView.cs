@@ -0,0 +1,115 @@
+using System;
+using System.Collections.Generic;
+using KuzuDot.Native;
+using KuzuDot.Native.Enums;
+
+namespace KuzuDot
+{
+    /// <summary>
+    /// A lazy view over a REL cell of the current <see cref="KuzuDataReader"/> row, from <see cref="KuzuDataReader.GetRelView"/>;
+    /// properties are decoded on access. Only valid until the reader advances; see <see cref="KuzuNodeView"/>.
+    /// </summary>
+    public readonly struct KuzuRelView
+    {
+        private readonly QueryResult _result;
+        private readonly long _rowVersion;
+        private readonly KuzuDot.Native.KuzuValue _cell;
+        private readonly GraphElementSchema _schema;
+
+        internal KuzuRelView(QueryResult result, KuzuDot.Native.KuzuValue cell, GraphElementSchema schema)
+        {
+            _result = result;
+            _rowVersion = result.RowVersion;
+            _cell = cell;
+            _schema = schema;
+        }
+
+        /// <summary>True while the reader is still on the row this view was taken from.</summary>
+        public bool IsCurrent => _result != null && !_result.IsDisposed && _result.RowVersion == _rowVersion;
+
+        public string Label => _schema?.Label;
+        public int PropertyCount => _schema?.Types.Length ?? 0;
+        /// <summary>Property names in engine order; index <c>i</c> matches <see cref="GetProperty(int)"/>.</summary>
+        public IReadOnlyList<string> PropertyNames => (IReadOnlyList<string>)_schema?.Names ?? Array.Empty<string>();
+
+        public unsafe InternalId Id
+        {
+            get
+            {
+                var cell = Cell();
+                if (NativeMethods.kuzu_rel_val_get_id_val((IntPtr)(&cell), out var idValue) != KuzuState.Success
+                    || NativeMethods.kuzu_value_get_internal_id((IntPtr)(&idValue), out var id) != KuzuState.Success)
+                    throw new KuzuException("Failed to get rel id");
+                return new InternalId(id);
+            }
+        }
+
+        /// <summary>Id of the node the rel starts from.</summary>
+        public unsafe InternalId SourceId
+        {
+            get
+            {
+                var cell = Cell();
+                if (NativeMethods.kuzu_rel_val_get_src_id_val((IntPtr)(&cell), out var idValue) != KuzuState.Success
+                    || NativeMethods.kuzu_value_get_internal_id((IntPtr)(&idValue), out var id) != KuzuState.Success)
+                    throw new KuzuException("Failed to get rel source id");
+                return new InternalId(id);
+            }
+        }
+
+        /// <summary>Id of the node the rel points to.</summary>
+        public unsafe InternalId DestinationId
+        {
+            get
+            {
+                var cell = Cell();
+                if (NativeMethods.kuzu_rel_val_get_dst_id_val((IntPtr)(&cell), out var idValue) != KuzuState.Success
+                    || NativeMethods.kuzu_value_get_internal_id((IntPtr)(&idValue), out var id) != KuzuState.Success)
+                    throw new KuzuException("Failed to get rel destination id");
+                return new InternalId(id);
+            }
+        }
+
+        /// <summary>Decodes a property by name; null when the property is NULL.</summary>
+        /// <exception cref="KeyNotFoundException">The rel has no property <paramref name="name"/>.</exception>
+        public object this[string name] => TryGetProperty(name, out var value) ? value : throw new KeyNotFoundException($"Rel '{Label}' has no property '{name}'");
+
+        public unsafe object GetProperty(int index)
+        {
+            if ((uint)index >= (uint)PropertyCount) throw new ArgumentOutOfRangeException(nameof(index));
+            var cell = Cell();
+            return GraphSchemaCache.ReadProperty((IntPtr)(&cell), _schema, index, isRel: true);
+        }
+
+        /// <summary>Decodes a property cast to <typeparamref name="T"/>; a NULL property yields <c>default</c>.</summary>
+        public T GetProperty<T>(string name)
+        {
+            var value = this[name];
+            return value == null ? default : (T)value;
+        }
+
+        public bool TryGetProperty(string name, out object value)
+        {
+            var index = _schema?.IndexOf(name) ?? -1;
+            value = index >= 0 ? GetProperty(index) : null;
+            return index >= 0;
+        }
+
+        /// <summary>Decodes the whole rel into a <see cref="KuzuRel"/> that outlives the row.</summary>
+        public unsafe KuzuRel ToRel()
+        {
+            var cell = Cell();
+            return _result.GraphSchemas.ReadRel((IntPtr)(&cell));
+        }
+
+        private KuzuDot.Native.KuzuValue Cell()
+        {
+            if (_result == null) throw new InvalidOperationException("View is not attached to a query result");
+            if (_result.IsDisposed) throw new ObjectDisposedException(nameof(QueryResult));
+            if (_result.RowVersion != _rowVersion) throw new InvalidOperationException("The reader has moved past the row this view was taken from");
+            return _cell;
+        }
+
+        public override string ToString() => $"KuzuRelView({Label}, Properties={PropertyCount}, Current={IsCurrent})";
+    }
+}
@@ -0,0 +1,101 @@
+using System;
+
+namespace KuzuDot
+{
+    public enum KuzuTransactionState
+    {
+        Active,
+        Committed,
+        RolledBack,
+    }
+
+    /// <summary>
+    /// An explicit transaction on a <see cref="KuzuDot.Connection"/>, started with <see cref="Connection.BeginTransaction"/>.
+    /// Statements run on the connection while it is active (queries, prepared statements, batches) join it and become
+    /// durable together on <see cref="Commit"/>. Disposing an active transaction rolls it back.
+    /// </summary>
+    /// <remarks>
+    /// A connection has at most one active transaction. If a statement fails, the engine rolls the transaction back;
+    /// <see cref="Rollback"/> and <see cref="Dispose"/> can still be called afterwards.
+    /// </remarks>
+    public sealed class KuzuTransaction : IDisposable
+    {
+        private readonly Connection _connection;
+
+        internal KuzuTransaction(Connection connection, bool readOnly)
+        {
+            _connection = connection;
+            IsReadOnly = readOnly;
+        }
+
+        public Connection Connection => _connection;
+        public bool IsReadOnly { get; }
+        public KuzuTransactionState State { get; private set; }
+
+        /// <summary>Makes the transaction's writes durable.</summary>
+        /// <exception cref="InvalidOperationException">The transaction is no longer active.</exception>
+        /// <exception cref="KuzuException">The commit failed; the transaction is rolled back.</exception>
+        public void Commit()
+        {
+            ThrowIfNotActive();
+            try { _connection.ExecuteNonQuery("COMMIT;"); }
+            catch (KuzuException)
+            {
+                TryRollback();
+                Complete(KuzuTransactionState.RolledBack);
+                throw;
+            }
+            Complete(KuzuTransactionState.Committed);
+        }
+
+        /// <summary>Discards the transaction's writes.</summary>
+        /// <exception cref="InvalidOperationException">The transaction is no longer active.</exception>
+        public void Rollback()
+        {
+            ThrowIfNotActive();
+            TryRollback();
+            Complete(KuzuTransactionState.RolledBack);
+        }
+
+        /// <summary>
+        /// Rolls back an abandoned transaction, e.g. when its connection is returned to a pool; false when <c>ROLLBACK</c>
+        /// failed, so the connection's native transaction state is unknown and it should not be reused.
+        /// </summary>
+        internal bool TryAbandon()
+        {
+            if (State != KuzuTransactionState.Active) return true;
+            var rolledBack = TryRollback();
+            Complete(KuzuTransactionState.RolledBack);
+            return rolledBack;
+        }
+
+        private bool TryRollback()
+        {
+            // Fails only when the engine has already rolled back after a statement error.
+            try { _connection.ExecuteNonQuery("ROLLBACK;"); return true; }
+            catch (KuzuException) { return false; }
+            catch (ObjectDisposedException) { return false; }
+        }
+
+        private void Complete(KuzuTransactionState state)
+        {
+            State = state;
+            _connection.EndTransaction(this);
+        }
+
+        private void ThrowIfNotActive()
+        {
+            if (State != KuzuTransactionState.Active) throw new InvalidOperationException($"Transaction is already {State}");
+        }
+
+        public override string ToString() => $"KuzuTransaction(State={State}, ReadOnly={IsReadOnly})";
+
+        /// <summary>
+        /// Rolls the transaction back if it has not been committed.
+        /// </summary>
+        public void Dispose()
+        {
+            if (State == KuzuTransactionState.Active) Rollback();
+        }
+    }
+}
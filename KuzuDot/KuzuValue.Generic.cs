@@ -60,48 +60,40 @@ namespace KuzuDot
 
         static KuzuValueTypeMap()
         {
-            // bool
-            if (typeof(T) == typeof(bool))
-            {
-                Creator = v => KuzuValue.CreateBool((bool)(object)v);
-                Getter = kv => (T)(object)kv.GetBool();
-                return;
-            }
+            // Each pair is created with its concrete signature and reinterpreted as Func<T, ...>/Func<..., T>; since the
+            // types are identical at runtime this is a reference conversion, so values never round-trip through object.
+            if (typeof(T) == typeof(bool)) { Set<bool>(KuzuValue.CreateBool, kv => kv.GetBool(), out Creator, out Getter); return; }
             // signed ints
-            if (typeof(T) == typeof(sbyte)) { Creator = v => KuzuValue.CreateInt8((sbyte)(object)v); Getter = kv => (T)(object)kv.GetInt8(); return; }
-            if (typeof(T) == typeof(short)) { Creator = v => KuzuValue.CreateInt16((short)(object)v); Getter = kv => (T)(object)kv.GetInt16(); return; }
-            if (typeof(T) == typeof(int)) { Creator = v => KuzuValue.CreateInt32((int)(object)v); Getter = kv => (T)(object)kv.GetInt32(); return; }
-            if (typeof(T) == typeof(long)) { Creator = v => KuzuValue.CreateInt64((long)(object)v); Getter = kv => (T)(object)kv.GetInt64(); return; }
+            if (typeof(T) == typeof(sbyte)) { Set<sbyte>(KuzuValue.CreateInt8, kv => kv.GetInt8(), out Creator, out Getter); return; }
+            if (typeof(T) == typeof(short)) { Set<short>(KuzuValue.CreateInt16, kv => kv.GetInt16(), out Creator, out Getter); return; }
+            if (typeof(T) == typeof(int)) { Set<int>(KuzuValue.CreateInt32, kv => kv.GetInt32(), out Creator, out Getter); return; }
+            if (typeof(T) == typeof(long)) { Set<long>(KuzuValue.CreateInt64, kv => kv.GetInt64(), out Creator, out Getter); return; }
             // unsigned ints
-            if (typeof(T) == typeof(byte)) { Creator = v => KuzuValue.CreateUInt8((byte)(object)v); Getter = kv => (T)(object)kv.GetUInt8(); return; }
-            if (typeof(T) == typeof(ushort)) { Creator = v => KuzuValue.CreateUInt16((ushort)(object)v); Getter = kv => (T)(object)kv.GetUInt16(); return; }
-            if (typeof(T) == typeof(uint)) { Creator = v => KuzuValue.CreateUInt32((uint)(object)v); Getter = kv => (T)(object)kv.GetUInt32(); return; }
-            if (typeof(T) == typeof(ulong)) { Creator = v => KuzuValue.CreateUInt64((ulong)(object)v); Getter = kv => (T)(object)kv.GetUInt64(); return; }
+            if (typeof(T) == typeof(byte)) { Set<byte>(KuzuValue.CreateUInt8, kv => kv.GetUInt8(), out Creator, out Getter); return; }
+            if (typeof(T) == typeof(ushort)) { Set<ushort>(KuzuValue.CreateUInt16, kv => kv.GetUInt16(), out Creator, out Getter); return; }
+            if (typeof(T) == typeof(uint)) { Set<uint>(KuzuValue.CreateUInt32, kv => kv.GetUInt32(), out Creator, out Getter); return; }
+            if (typeof(T) == typeof(ulong)) { Set<ulong>(KuzuValue.CreateUInt64, kv => kv.GetUInt64(), out Creator, out Getter); return; }
             // floating point
-            if (typeof(T) == typeof(float)) { Creator = v => KuzuValue.CreateFloat((float)(object)v); Getter = kv => (T)(object)kv.GetFloat(); return; }
-            if (typeof(T) == typeof(double)) { Creator = v => KuzuValue.CreateDouble((double)(object)v); Getter = kv => (T)(object)kv.GetDouble(); return; }
+            if (typeof(T) == typeof(float)) { Set<float>(KuzuValue.CreateFloat, kv => kv.GetFloat(), out Creator, out Getter); return; }
+            if (typeof(T) == typeof(double)) { Set<double>(KuzuValue.CreateDouble, kv => kv.GetDouble(), out Creator, out Getter); return; }
             // BigInteger
-            if (typeof(T) == typeof(BigInteger)) { Creator = v => KuzuValue.CreateBigInteger((BigInteger)(object)v); Getter = kv => (T)(object)kv.GetBigInteger(); return; }
+            if (typeof(T) == typeof(BigInteger)) { Set<BigInteger>(KuzuValue.CreateBigInteger, kv => kv.GetBigInteger(), out Creator, out Getter); return; }
             // string
-            if (typeof(T) == typeof(string)) { Creator = v => KuzuValue.CreateString((string)(object)v); Getter = kv => (T)(object)kv.GetString(); return; }
+            if (typeof(T) == typeof(string)) { Set<string>(KuzuValue.CreateString, kv => kv.GetString(), out Creator, out Getter); return; }
             // DateTime (treat as Timestamp by default) - users wanting Date-only should call utility on non-generic API.
-            if (typeof(T) == typeof(DateTime))
-            {
-                Creator = v => KuzuValue.CreateTimestamp((DateTime)(object)v);
-                Getter = kv => (T)(object)kv.GetTimestampAsDateTime();
-                return;
-            }
+            if (typeof(T) == typeof(DateTime)) { Set<DateTime>(KuzuValue.CreateTimestamp, kv => kv.GetTimestampAsDateTime(), out Creator, out Getter); return; }
             // InternalId wrapper
-            if (typeof(T) == typeof(InternalId))
-            {
-                Creator = v => KuzuValue.CreateInternalId((InternalId)(object)v);
-                Getter = kv => (T)(object)kv.GetInternalId();
-                return;
-            }
+            if (typeof(T) == typeof(InternalId)) { Set<InternalId>(KuzuValue.CreateInternalId, kv => kv.GetInternalId(), out Creator, out Getter); return; }
 
             // Unsupported -> throw early when attempting to use
             Creator = _ => throw new NotSupportedException($"Type {typeof(T)} is not supported by KuzuValue<T>.");
             Getter = _ => throw new NotSupportedException($"Type {typeof(T)} is not supported by KuzuValue<T>.");
         }
+
+        private static void Set<TValue>(Func<TValue, KuzuValue> creator, Func<KuzuValue, TValue> getter, out Func<T, KuzuValue> typedCreator, out Func<KuzuValue, T> typedGetter)
+        {
+            typedCreator = (Func<T, KuzuValue>)(Delegate)creator;
+            typedGetter = (Func<KuzuValue, T>)(Delegate)getter;
+        }
     }
 }
@@ -7,6 +7,12 @@ using KuzuDot.Native.Enums;
 
 namespace KuzuDot
 {
+    /// <summary>
+    /// A Kuzu value. Accessors are unsynchronized: each native call holds a reference on the underlying SafeHandle,
+    /// so disposing a value while another thread reads it is safe (the read completes, later reads throw
+    /// <see cref="ObjectDisposedException"/>), but concurrent <see cref="SetNull"/>/<see cref="CopyFrom"/> calls on
+    /// the same instance must be coordinated by the caller.
+    /// </summary>
     public class KuzuValue : IDisposable
     {
         private sealed class KuzuValueSafeHandle : SafeHandle
@@ -22,9 +28,11 @@ namespace KuzuDot
         }
 
         private readonly KuzuValueSafeHandle _handle;
-        private readonly object _lockObject = new object();
         private KuzuValue(KuzuValueSafeHandle handle) { _handle = handle; }
 
+        /// <summary>Schema cache of the result this value was read from, if any; used by <see cref="ReadNode"/>/<see cref="ReadRel"/>.</summary>
+        internal GraphSchemaCache GraphSchemas { get; set; }
+
         public static KuzuValue CreateNull() => CreateOwned(NativeMethods.kuzu_value_create_null(), "null");
         public static KuzuValue CreateBool(bool value) => CreateOwned(NativeMethods.kuzu_value_create_bool(value), "boolean");
         public static KuzuValue CreateInt8(sbyte value) => CreateOwned(NativeMethods.kuzu_value_create_int8(value), "int8");
@@ -93,7 +101,7 @@ namespace KuzuDot
                     {
                         if (string.IsNullOrEmpty(fields[i].Name)) throw new ArgumentException("Field name cannot be null or empty", nameof(fields));
                         if (fields[i].Value == null) throw new ArgumentNullException($"fields[{i}].Value");
-                        var namePtr = Marshal.StringToHGlobalAnsi(fields[i].Name);
+                        var namePtr = NativeUtil.StringToHGlobalUtf8(fields[i].Name);
                         allocatedNames[i] = namePtr;
                         Marshal.WriteIntPtr(namesPtr, i * IntPtr.Size, namePtr);
                         Marshal.WriteIntPtr(valuesPtr, i * IntPtr.Size, fields[i].Value._handle.DangerousGetHandle());
@@ -144,7 +152,17 @@ namespace KuzuDot
             return CreateOwned(outValPtr, "map");
         }
 
-        // NOTE: There is no native create-blob API; users must provide blobs via query literals/casts.
+        /// <summary>
+        /// Creates a STRING value holding <paramref name="data"/> in the engine's escaped BLOB text form (<c>\xHH</c> for
+        /// non-printable bytes). The C API has no blob constructor, so convert it where a BLOB is required: <c>BLOB($data)</c>
+        /// parses the escapes and stores the original bytes. Passing it as a parameter keeps the payload out of the query text.
+        /// </summary>
+        public static unsafe KuzuValue CreateBlob(ReadOnlySpan<byte> data)
+        {
+            var text = BlobCodec.EncodeNullTerminated(data, stackalloc byte[256], out var rented);
+            try { fixed (byte* p = text) return CreateOwned(NativeMethods.kuzu_value_create_string((IntPtr)p), "blob"); }
+            finally { NativeUtil.Return(rented); }
+        }
 
         private static KuzuInt128 BigIntegerToNative(BigInteger value)
         { var bytes = value.ToByteArray(); if (bytes.Length > 16) throw new OverflowException("BigInteger does not fit into 128 bits"); byte[] padded = new byte[16]; byte fill = (value.Sign < 0) ? (byte)0xFF : (byte)0x00; for (int i = 0; i < 16; i++) padded[i] = fill; Array.Copy(bytes, 0, padded, 0, bytes.Length); ulong low = BitConverter.ToUInt64(padded, 0); long high = BitConverter.ToInt64(padded, 8); return new KuzuInt128 { Low = low, High = high }; }
@@ -156,108 +174,140 @@ namespace KuzuDot
 
         internal KuzuDot.Native.KuzuValue Handle => new KuzuDot.Native.KuzuValue { Value = _handle.DangerousGetHandle(), IsOwnedByCpp = _handle.IsOwnedByCppNative };
 
-        public bool IsNull() { lock (_lockObject) { ThrowIfDisposed(); if (_handle.IsInvalid) return true; return NativeMethods.kuzu_value_is_null(_handle.DangerousGetHandle()); } }
-        public void SetNull(bool isNull) { lock (_lockObject) { EnsureAliveAndValid(); NativeMethods.kuzu_value_set_null(_handle.DangerousGetHandle(), isNull); } }
+        public bool IsNull() { using (var lease = Lease()) return NativeMethods.kuzu_value_is_null(lease.Pointer); }
+        public void SetNull(bool isNull) { using (var lease = Lease()) { NativeMethods.kuzu_value_set_null(lease.Pointer, isNull); } }
 
-        public DataType GetDataType() { lock (_lockObject) { EnsureAliveAndValid(); NativeMethods.kuzu_value_get_data_type(_handle.DangerousGetHandle(), out KuzuLogicalTypeNative t); return DataType.FromBorrowed(in t); } }
+        public DataType GetDataType() { using (var lease = Lease()) { NativeMethods.kuzu_value_get_data_type(lease.Pointer, out KuzuLogicalTypeNative t); return DataType.FromBorrowed(in t); } }
 
-        public bool GetBool() => GetPrimitive("boolean", NativeMethods.kuzu_value_get_bool, out bool v) ? v : default;
-        public sbyte GetInt8() => GetPrimitive("int8", NativeMethods.kuzu_value_get_int8, out sbyte v) ? v : default;
-        public short GetInt16() => GetPrimitive("int16", NativeMethods.kuzu_value_get_int16, out short v) ? v : default;
-        public int GetInt32() => GetPrimitive("int32", NativeMethods.kuzu_value_get_int32, out int v) ? v : default;
-        public long GetInt64() { lock (_lockObject) { EnsureAliveAndValid(); var state = NativeMethods.kuzu_value_get_int64(_handle.DangerousGetHandle(), out var val); if (state != KuzuState.Success) throw new KuzuException("Failed to get int64 value - type mismatch or invalid value"); return val; } }
-        public byte GetUInt8() => GetPrimitive("uint8", NativeMethods.kuzu_value_get_uint8, out byte v) ? v : default;
-        public ushort GetUInt16() => GetPrimitive("uint16", NativeMethods.kuzu_value_get_uint16, out ushort v) ? v : default;
-        public uint GetUInt32() => GetPrimitive("uint32", NativeMethods.kuzu_value_get_uint32, out uint v) ? v : default;
-        public ulong GetUInt64() => GetPrimitive("uint64", NativeMethods.kuzu_value_get_uint64, out ulong v) ? v : default;
-        internal KuzuInt128 GetNativeInt128() => GetPrimitive("int128", NativeMethods.kuzu_value_get_int128, out KuzuInt128 v) ? v : default;
+        public bool GetBool() { using (var lease = Lease()) { ThrowIfGetFailed(NativeMethods.kuzu_value_get_bool(lease.Pointer, out bool v), "boolean"); return v; } }
+        public sbyte GetInt8() { using (var lease = Lease()) { ThrowIfGetFailed(NativeMethods.kuzu_value_get_int8(lease.Pointer, out sbyte v), "int8"); return v; } }
+        public short GetInt16() { using (var lease = Lease()) { ThrowIfGetFailed(NativeMethods.kuzu_value_get_int16(lease.Pointer, out short v), "int16"); return v; } }
+        public int GetInt32() { using (var lease = Lease()) { ThrowIfGetFailed(NativeMethods.kuzu_value_get_int32(lease.Pointer, out int v), "int32"); return v; } }
+        public long GetInt64() { using (var lease = Lease()) { var state = NativeMethods.kuzu_value_get_int64(lease.Pointer, out var val); if (state != KuzuState.Success) throw new KuzuException("Failed to get int64 value - type mismatch or invalid value"); return val; } }
+        public byte GetUInt8() { using (var lease = Lease()) { ThrowIfGetFailed(NativeMethods.kuzu_value_get_uint8(lease.Pointer, out byte v), "uint8"); return v; } }
+        public ushort GetUInt16() { using (var lease = Lease()) { ThrowIfGetFailed(NativeMethods.kuzu_value_get_uint16(lease.Pointer, out ushort v), "uint16"); return v; } }
+        public uint GetUInt32() { using (var lease = Lease()) { ThrowIfGetFailed(NativeMethods.kuzu_value_get_uint32(lease.Pointer, out uint v), "uint32"); return v; } }
+        public ulong GetUInt64() { using (var lease = Lease()) { ThrowIfGetFailed(NativeMethods.kuzu_value_get_uint64(lease.Pointer, out ulong v), "uint64"); return v; } }
+        internal KuzuInt128 GetNativeInt128() { using (var lease = Lease()) { ThrowIfGetFailed(NativeMethods.kuzu_value_get_int128(lease.Pointer, out KuzuInt128 v), "int128"); return v; } }
         public BigInteger GetBigInteger() => NativeToBigInteger(GetNativeInt128());
-        public float GetFloat() => GetPrimitive("float", NativeMethods.kuzu_value_get_float, out float v) ? v : default;
-        public double GetDouble() => GetPrimitive("double", NativeMethods.kuzu_value_get_double, out double v) ? v : default;
-        public InternalId GetInternalId() { var native = GetPrimitive("internal id", NativeMethods.kuzu_value_get_internal_id, out KuzuInternalIdNative v) ? v : default; return new InternalId(native); }
-        private KuzuDate GetNativeDate() { lock (_lockObject) { EnsureAliveAndValid(); var state = NativeMethods.kuzu_value_get_date(_handle.DangerousGetHandle(), out KuzuDate v); if (state != KuzuState.Success) throw new KuzuException("Failed to get date value - type mismatch or invalid value"); return v; } }
+        public float GetFloat() { using (var lease = Lease()) { ThrowIfGetFailed(NativeMethods.kuzu_value_get_float(lease.Pointer, out float v), "float"); return v; } }
+        public double GetDouble() { using (var lease = Lease()) { ThrowIfGetFailed(NativeMethods.kuzu_value_get_double(lease.Pointer, out double v), "double"); return v; } }
+        public InternalId GetInternalId() { using (var lease = Lease()) { ThrowIfGetFailed(NativeMethods.kuzu_value_get_internal_id(lease.Pointer, out KuzuInternalIdNative v), "internal id"); return new InternalId(v); } }
+        private KuzuDate GetNativeDate() { using (var lease = Lease()) { var state = NativeMethods.kuzu_value_get_date(lease.Pointer, out KuzuDate v); if (state != KuzuState.Success) throw new KuzuException("Failed to get date value - type mismatch or invalid value"); return v; } }
         public DateTime GetDate() => DateTimeUtilities.KuzuDateToDateTime(GetNativeDate());
-        public DateTime GetTimestampAsDateTime() { lock (_lockObject) { EnsureAliveAndValid(); var state = NativeMethods.kuzu_value_get_timestamp(_handle.DangerousGetHandle(), out KuzuTimestamp ts); if (state != KuzuState.Success) throw new KuzuException("Failed to get timestamp value"); return DateTimeUtilities.NativeTimestampToDateTime(ts); } }
-        public long GetTimestampUnixMicros() { lock (_lockObject) { EnsureAliveAndValid(); var state = NativeMethods.kuzu_value_get_timestamp(_handle.DangerousGetHandle(), out KuzuTimestamp ts); if (state != KuzuState.Success) throw new KuzuException("Failed to get timestamp value"); return ts.Value; } }
-        public long GetTimestampNsUnixNanoseconds() { lock (_lockObject) { EnsureAliveAndValid(); var st = NativeMethods.kuzu_value_get_timestamp_ns(_handle.DangerousGetHandle(), out KuzuTimestampNs ts); if (st != KuzuState.Success) throw new KuzuException("Failed to get timestamp_ns value"); return ts.Value; } }
-        public long GetTimestampMsUnixMilliseconds() { lock (_lockObject) { EnsureAliveAndValid(); var st = NativeMethods.kuzu_value_get_timestamp_ms(_handle.DangerousGetHandle(), out KuzuTimestampMs ts); if (st != KuzuState.Success) throw new KuzuException("Failed to get timestamp_ms value"); return ts.Value; } }
-        public long GetTimestampSecUnixSeconds() { lock (_lockObject) { EnsureAliveAndValid(); var st = NativeMethods.kuzu_value_get_timestamp_sec(_handle.DangerousGetHandle(), out KuzuTimestampSec ts); if (st != KuzuState.Success) throw new KuzuException("Failed to get timestamp_sec value"); return ts.Value; } }
-        public long GetTimestampTzUnixMicros() { lock (_lockObject) { EnsureAliveAndValid(); var st = NativeMethods.kuzu_value_get_timestamp_tz(_handle.DangerousGetHandle(), out KuzuTimestampTz ts); if (st != KuzuState.Success) throw new KuzuException("Failed to get timestamp_tz value"); return ts.Value; } }
-        public TimeSpan GetInterval() { lock (_lockObject) { EnsureAliveAndValid(); var state = NativeMethods.kuzu_value_get_interval(_handle.DangerousGetHandle(), out KuzuInterval iv); if (state != KuzuState.Success) throw new KuzuException("Failed to get interval value"); return DateTimeUtilities.NativeIntervalToTimeSpan(iv); } }
-        public string GetString() { lock (_lockObject) { EnsureAliveAndValid(); var state = NativeMethods.kuzu_value_get_string(_handle.DangerousGetHandle(), out var ptr); if (state != KuzuState.Success) throw new KuzuException("Failed to get string value - type mismatch or invalid value"); if (ptr == IntPtr.Zero) return string.Empty; try { return Marshal.PtrToStringAnsi(ptr) ?? string.Empty; } finally { NativeMethods.kuzu_destroy_string(ptr); } } }
-        public string GetDecimalAsString() { lock (_lockObject) { EnsureAliveAndValid(); var state = NativeMethods.kuzu_value_get_decimal_as_string(_handle.DangerousGetHandle(), out var ptr); if (state != KuzuState.Success) throw new KuzuException("Failed to get decimal value"); if (ptr == IntPtr.Zero) return string.Empty; try { return Marshal.PtrToStringAnsi(ptr) ?? string.Empty; } finally { NativeMethods.kuzu_destroy_string(ptr); } } }
-        public string GetUuid() { lock (_lockObject) { EnsureAliveAndValid(); var state = NativeMethods.kuzu_value_get_uuid(_handle.DangerousGetHandle(), out var ptr); if (state != KuzuState.Success) throw new KuzuException("Failed to get uuid value"); if (ptr == IntPtr.Zero) return string.Empty; try { return Marshal.PtrToStringAnsi(ptr) ?? string.Empty; } finally { NativeMethods.kuzu_destroy_string(ptr); } } }
-        public byte[] GetBlob()
+        public DateTime GetTimestampAsDateTime() { using (var lease = Lease()) { var state = NativeMethods.kuzu_value_get_timestamp(lease.Pointer, out KuzuTimestamp ts); if (state != KuzuState.Success) throw new KuzuException("Failed to get timestamp value"); return DateTimeUtilities.NativeTimestampToDateTime(ts); } }
+        public long GetTimestampUnixMicros() { using (var lease = Lease()) { var state = NativeMethods.kuzu_value_get_timestamp(lease.Pointer, out KuzuTimestamp ts); if (state != KuzuState.Success) throw new KuzuException("Failed to get timestamp value"); return ts.Value; } }
+        public long GetTimestampNsUnixNanoseconds() { using (var lease = Lease()) { var st = NativeMethods.kuzu_value_get_timestamp_ns(lease.Pointer, out KuzuTimestampNs ts); if (st != KuzuState.Success) throw new KuzuException("Failed to get timestamp_ns value"); return ts.Value; } }
+        public long GetTimestampMsUnixMilliseconds() { using (var lease = Lease()) { var st = NativeMethods.kuzu_value_get_timestamp_ms(lease.Pointer, out KuzuTimestampMs ts); if (st != KuzuState.Success) throw new KuzuException("Failed to get timestamp_ms value"); return ts.Value; } }
+        public long GetTimestampSecUnixSeconds() { using (var lease = Lease()) { var st = NativeMethods.kuzu_value_get_timestamp_sec(lease.Pointer, out KuzuTimestampSec ts); if (st != KuzuState.Success) throw new KuzuException("Failed to get timestamp_sec value"); return ts.Value; } }
+        public long GetTimestampTzUnixMicros() { using (var lease = Lease()) { var st = NativeMethods.kuzu_value_get_timestamp_tz(lease.Pointer, out KuzuTimestampTz ts); if (st != KuzuState.Success) throw new KuzuException("Failed to get timestamp_tz value"); return ts.Value; } }
+        public TimeSpan GetInterval() { using (var lease = Lease()) { var state = NativeMethods.kuzu_value_get_interval(lease.Pointer, out KuzuInterval iv); if (state != KuzuState.Success) throw new KuzuException("Failed to get interval value"); return DateTimeUtilities.NativeIntervalToTimeSpan(iv); } }
+        public string GetString() { using (var lease = Lease()) { var state = NativeMethods.kuzu_value_get_string(lease.Pointer, out var ptr); if (state != KuzuState.Success) throw new KuzuException("Failed to get string value - type mismatch or invalid value"); if (ptr == IntPtr.Zero) return string.Empty; try { return NativeUtil.PtrToStringUtf8(ptr) ?? string.Empty; } finally { NativeMethods.kuzu_destroy_string(ptr); } } }
+        public string GetDecimalAsString() { using (var lease = Lease()) { var state = NativeMethods.kuzu_value_get_decimal_as_string(lease.Pointer, out var ptr); if (state != KuzuState.Success) throw new KuzuException("Failed to get decimal value"); if (ptr == IntPtr.Zero) return string.Empty; try { return NativeUtil.PtrToStringUtf8(ptr) ?? string.Empty; } finally { NativeMethods.kuzu_destroy_string(ptr); } } }
+        public string GetUuid() { using (var lease = Lease()) { var state = NativeMethods.kuzu_value_get_uuid(lease.Pointer, out var ptr); if (state != KuzuState.Success) throw new KuzuException("Failed to get uuid value"); if (ptr == IntPtr.Zero) return string.Empty; try { return NativeUtil.PtrToStringUtf8(ptr) ?? string.Empty; } finally { NativeMethods.kuzu_destroy_string(ptr); } } }
+        /// <summary>Gets the decoded size in bytes of a BLOB value, e.g. to size the buffer for <see cref="GetBlob(Span{byte})"/>.</summary>
+        public int GetBlobLength()
+        {
+            using (var lease = Lease())
+            {
+                var text = GetBlobText(lease.Pointer);
+                try { return BlobCodec.GetDecodedLength(NativeUtil.Utf8Span(text)); }
+                finally { NativeMethods.kuzu_destroy_string(text); }
+            }
+        }
+
+        /// <summary>Copies a BLOB value into <paramref name="destination"/> and returns the number of bytes written.</summary>
+        /// <exception cref="ArgumentException"><paramref name="destination"/> is shorter than <see cref="GetBlobLength"/>.</exception>
+        public int GetBlob(Span<byte> destination)
         {
-            lock (_lockObject)
+            using (var lease = Lease())
             {
-                EnsureAliveAndValid();
-                var state = NativeMethods.kuzu_value_get_blob(_handle.DangerousGetHandle(), out var ptr);
-                if (state != KuzuState.Success) throw new KuzuException("Failed to get blob value - type mismatch or invalid value");
-                if (ptr == IntPtr.Zero) return new byte[0];
+                var text = GetBlobText(lease.Pointer);
                 try
                 {
-                    var hex = Marshal.PtrToStringAnsi(ptr) ?? string.Empty;
-                    if (hex.Length == 0) return Array.Empty<byte>();
-                    hex = hex.Trim();
-                    if (hex.StartsWith("0x", StringComparison.OrdinalIgnoreCase)) hex = hex.Substring(2);
-                    if (hex.Length % 2 != 0) throw new KuzuException("Invalid blob hex length returned from native layer");
-                    int len = hex.Length / 2;
-                    var bytes = new byte[len];
-                    for (int i = 0; i < len; i++) bytes[i] = Convert.ToByte(hex.Substring(i * 2, 2), 16);
-                    return bytes;
+                    var span = NativeUtil.Utf8Span(text);
+                    var length = BlobCodec.GetDecodedLength(span);
+                    if (destination.Length < length) throw new ArgumentException($"Destination is too small for a {length}-byte blob", nameof(destination));
+                    return BlobCodec.Decode(span, destination);
                 }
-                finally { NativeMethods.kuzu_destroy_blob(ptr); }
+                finally { NativeMethods.kuzu_destroy_string(text); }
             }
         }
-        public ulong GetListSize() => GetPrimitive("list size", NativeMethods.kuzu_value_get_list_size, out ulong s) ? s : 0UL;
-        public KuzuValue GetListElement(ulong index) { lock (_lockObject) { EnsureAliveAndValid(); var state = NativeMethods.kuzu_value_get_list_element(_handle.DangerousGetHandle(), index, out var h); if (state != KuzuState.Success) throw new KuzuException($"Failed to get list element at index {index}"); h.IsOwnedByCpp = true; return CreateBorrowedFromRaw(h); } }
-        public ulong GetStructNumFields() => GetPrimitive("struct field count", NativeMethods.kuzu_value_get_struct_num_fields, out ulong c) ? c : 0UL;
-        public string GetStructFieldName(ulong index) { lock (_lockObject) { EnsureAliveAndValid(); var state = NativeMethods.kuzu_value_get_struct_field_name(_handle.DangerousGetHandle(), index, out var ptr); if (state != KuzuState.Success) throw new KuzuException($"Failed to get struct field name at index {index}"); if (ptr == IntPtr.Zero) return string.Empty; try { return Marshal.PtrToStringAnsi(ptr) ?? string.Empty; } finally { NativeMethods.kuzu_destroy_string(ptr); } } }
-        public KuzuValue GetStructFieldValue(ulong index) { lock (_lockObject) { EnsureAliveAndValid(); var state = NativeMethods.kuzu_value_get_struct_field_value(_handle.DangerousGetHandle(), index, out var h); if (state != KuzuState.Success) throw new KuzuException($"Failed to get struct field value at index {index}"); h.IsOwnedByCpp = true; return CreateBorrowedFromRaw(h); } }
+
+        public byte[] GetBlob()
+        {
+            using (var lease = Lease())
+            {
+                var text = GetBlobText(lease.Pointer);
+                try { return BlobCodec.Decode(NativeUtil.Utf8Span(text)); }
+                finally { NativeMethods.kuzu_destroy_string(text); }
+            }
+        }
+
+        /// <summary>Gets the escaped text form of a BLOB value; see <see cref="BlobCodec"/> for why the raw blob getter is not used.</summary>
+        private static IntPtr GetBlobText(IntPtr value)
+        {
+            var text = ValueDecoder.GetBlobText(value);
+            if (text == IntPtr.Zero) throw new KuzuException("Failed to get blob value - type mismatch or invalid value");
+            return text;
+        }
+        public ulong GetListSize() { using (var lease = Lease()) { ThrowIfGetFailed(NativeMethods.kuzu_value_get_list_size(lease.Pointer, out ulong s), "list size"); return s; } }
+        public KuzuValue GetListElement(ulong index) { using (var lease = Lease()) { var state = NativeMethods.kuzu_value_get_list_element(lease.Pointer, index, out var h); if (state != KuzuState.Success) throw new KuzuException($"Failed to get list element at index {index}"); h.IsOwnedByCpp = true; return CreateBorrowedFromRaw(h); } }
+        public ulong GetStructNumFields() { using (var lease = Lease()) { ThrowIfGetFailed(NativeMethods.kuzu_value_get_struct_num_fields(lease.Pointer, out ulong c), "struct field count"); return c; } }
+        public string GetStructFieldName(ulong index) { using (var lease = Lease()) { var state = NativeMethods.kuzu_value_get_struct_field_name(lease.Pointer, index, out var ptr); if (state != KuzuState.Success) throw new KuzuException($"Failed to get struct field name at index {index}"); if (ptr == IntPtr.Zero) return string.Empty; try { return NativeUtil.PtrToStringUtf8(ptr) ?? string.Empty; } finally { NativeMethods.kuzu_destroy_string(ptr); } } }
+        public KuzuValue GetStructFieldValue(ulong index) { using (var lease = Lease()) { var state = NativeMethods.kuzu_value_get_struct_field_value(lease.Pointer, index, out var h); if (state != KuzuState.Success) throw new KuzuException($"Failed to get struct field value at index {index}"); h.IsOwnedByCpp = true; return CreateBorrowedFromRaw(h); } }
 
         // Map helpers
-        public ulong GetMapSize() => GetPrimitive("map size", NativeMethods.kuzu_value_get_map_size, out ulong s) ? s : 0UL;
-        public KuzuValue GetMapKey(ulong index) { lock (_lockObject) { EnsureAliveAndValid(); var st = NativeMethods.kuzu_value_get_map_key(_handle.DangerousGetHandle(), index, out var h); if (st != KuzuState.Success) throw new KuzuException($"Failed to get map key at index {index}"); h.IsOwnedByCpp = true; return CreateBorrowedFromRaw(h); } }
-        public KuzuValue GetMapValue(ulong index) { lock (_lockObject) { EnsureAliveAndValid(); var st = NativeMethods.kuzu_value_get_map_value(_handle.DangerousGetHandle(), index, out var h); if (st != KuzuState.Success) throw new KuzuException($"Failed to get map value at index {index}"); h.IsOwnedByCpp = true; return CreateBorrowedFromRaw(h); } }
+        public ulong GetMapSize() { using (var lease = Lease()) { ThrowIfGetFailed(NativeMethods.kuzu_value_get_map_size(lease.Pointer, out ulong s), "map size"); return s; } }
+        public KuzuValue GetMapKey(ulong index) { using (var lease = Lease()) { var st = NativeMethods.kuzu_value_get_map_key(lease.Pointer, index, out var h); if (st != KuzuState.Success) throw new KuzuException($"Failed to get map key at index {index}"); h.IsOwnedByCpp = true; return CreateBorrowedFromRaw(h); } }
+        public KuzuValue GetMapValue(ulong index) { using (var lease = Lease()) { var st = NativeMethods.kuzu_value_get_map_value(lease.Pointer, index, out var h); if (st != KuzuState.Success) throw new KuzuException($"Failed to get map value at index {index}"); h.IsOwnedByCpp = true; return CreateBorrowedFromRaw(h); } }
 
         // Recursive rel helpers
-        public KuzuValue GetRecursiveRelNodeList() { lock (_lockObject) { EnsureAliveAndValid(); var st = NativeMethods.kuzu_value_get_recursive_rel_node_list(_handle.DangerousGetHandle(), out var h); if (st != KuzuState.Success) throw new KuzuException("Failed to get recursive rel node list"); h.IsOwnedByCpp = true; return CreateBorrowedFromRaw(h); } }
-        public KuzuValue GetRecursiveRelRelList() { lock (_lockObject) { EnsureAliveAndValid(); var st = NativeMethods.kuzu_value_get_recursive_rel_rel_list(_handle.DangerousGetHandle(), out var h); if (st != KuzuState.Success) throw new KuzuException("Failed to get recursive rel rel list"); h.IsOwnedByCpp = true; return CreateBorrowedFromRaw(h); } }
+        public KuzuValue GetRecursiveRelNodeList() { using (var lease = Lease()) { var st = NativeMethods.kuzu_value_get_recursive_rel_node_list(lease.Pointer, out var h); if (st != KuzuState.Success) throw new KuzuException("Failed to get recursive rel node list"); h.IsOwnedByCpp = true; return CreateBorrowedFromRaw(h); } }
+        public KuzuValue GetRecursiveRelRelList() { using (var lease = Lease()) { var st = NativeMethods.kuzu_value_get_recursive_rel_rel_list(lease.Pointer, out var h); if (st != KuzuState.Success) throw new KuzuException("Failed to get recursive rel rel list"); h.IsOwnedByCpp = true; return CreateBorrowedFromRaw(h); } }
+        /// <summary>
+        /// Decodes this RECURSIVE_REL (path) value into contiguous node and rel id arrays without a wrapper per hop.
+        /// With <paramref name="includeProperties"/>, each node and rel is also fully decoded as by <see cref="ReadNode"/>.
+        /// </summary>
+        public KuzuPath ReadPath(bool includeProperties = false) { using (var lease = Lease()) return KuzuPath.Read(lease.Pointer, GraphSchemas ?? new GraphSchemaCache(), includeProperties); }
 
         // Node helpers
-        public KuzuValue GetNodeIdValue() { lock (_lockObject) { EnsureAliveAndValid(); var st = NativeMethods.kuzu_node_val_get_id_val(_handle.DangerousGetHandle(), out var h); if (st != KuzuState.Success) throw new KuzuException("Failed to get node id value"); h.IsOwnedByCpp = true; return CreateBorrowedFromRaw(h); } }
-        public KuzuValue GetNodeLabelValue() { lock (_lockObject) { EnsureAliveAndValid(); var st = NativeMethods.kuzu_node_val_get_label_val(_handle.DangerousGetHandle(), out var h); if (st != KuzuState.Success) throw new KuzuException("Failed to get node label value"); h.IsOwnedByCpp = true; return CreateBorrowedFromRaw(h); } }
-        public ulong GetNodePropertySize() { lock (_lockObject) { EnsureAliveAndValid(); var st = NativeMethods.kuzu_node_val_get_property_size(_handle.DangerousGetHandle(), out ulong sz); if (st != KuzuState.Success) throw new KuzuException("Failed to get node property size"); return sz; } }
-        public string GetNodePropertyNameAt(ulong index) { lock (_lockObject) { EnsureAliveAndValid(); var st = NativeMethods.kuzu_node_val_get_property_name_at(_handle.DangerousGetHandle(), index, out var ptr); if (st != KuzuState.Success) throw new KuzuException($"Failed to get node property name at index {index}"); if (ptr == IntPtr.Zero) return string.Empty; try { return Marshal.PtrToStringAnsi(ptr) ?? string.Empty; } finally { NativeMethods.kuzu_destroy_string(ptr); } } }
-        public KuzuValue GetNodePropertyValueAt(ulong index) { lock (_lockObject) { EnsureAliveAndValid(); var st = NativeMethods.kuzu_node_val_get_property_value_at(_handle.DangerousGetHandle(), index, out var h); if (st != KuzuState.Success) throw new KuzuException($"Failed to get node property value at index {index}"); h.IsOwnedByCpp = true; return CreateBorrowedFromRaw(h); } }
-        public string GetNodeString() { lock (_lockObject) { EnsureAliveAndValid(); var st = NativeMethods.kuzu_node_val_to_string(_handle.DangerousGetHandle(), out var ptr); if (st != KuzuState.Success) throw new KuzuException("Failed to convert node to string"); if (ptr == IntPtr.Zero) return string.Empty; try { return Marshal.PtrToStringAnsi(ptr) ?? string.Empty; } finally { NativeMethods.kuzu_destroy_string(ptr); } } }
+        public KuzuValue GetNodeIdValue() { using (var lease = Lease()) { var st = NativeMethods.kuzu_node_val_get_id_val(lease.Pointer, out var h); if (st != KuzuState.Success) throw new KuzuException("Failed to get node id value"); h.IsOwnedByCpp = true; return CreateBorrowedFromRaw(h); } }
+        public KuzuValue GetNodeLabelValue() { using (var lease = Lease()) { var st = NativeMethods.kuzu_node_val_get_label_val(lease.Pointer, out var h); if (st != KuzuState.Success) throw new KuzuException("Failed to get node label value"); h.IsOwnedByCpp = true; return CreateBorrowedFromRaw(h); } }
+        public ulong GetNodePropertySize() { using (var lease = Lease()) { var st = NativeMethods.kuzu_node_val_get_property_size(lease.Pointer, out ulong sz); if (st != KuzuState.Success) throw new KuzuException("Failed to get node property size"); return sz; } }
+        public string GetNodePropertyNameAt(ulong index) { using (var lease = Lease()) { var st = NativeMethods.kuzu_node_val_get_property_name_at(lease.Pointer, index, out var ptr); if (st != KuzuState.Success) throw new KuzuException($"Failed to get node property name at index {index}"); if (ptr == IntPtr.Zero) return string.Empty; try { return NativeUtil.PtrToStringUtf8(ptr) ?? string.Empty; } finally { NativeMethods.kuzu_destroy_string(ptr); } } }
+        public KuzuValue GetNodePropertyValueAt(ulong index) { using (var lease = Lease()) { var st = NativeMethods.kuzu_node_val_get_property_value_at(lease.Pointer, index, out var h); if (st != KuzuState.Success) throw new KuzuException($"Failed to get node property value at index {index}"); h.IsOwnedByCpp = true; return CreateBorrowedFromRaw(h); } }
+        /// <summary>
+        /// Decodes this node's id, label and all properties in one pass. Values read from a <see cref="FlatTuple"/> share
+        /// their result's cache of per-label property names.
+        /// </summary>
+        public KuzuNode ReadNode() { using (var lease = Lease()) return (GraphSchemas ?? new GraphSchemaCache()).ReadNode(lease.Pointer); }
+        public string GetNodeString() { using (var lease = Lease()) { var st = NativeMethods.kuzu_node_val_to_string(lease.Pointer, out var ptr); if (st != KuzuState.Success) throw new KuzuException("Failed to convert node to string"); if (ptr == IntPtr.Zero) return string.Empty; try { return NativeUtil.PtrToStringUtf8(ptr) ?? string.Empty; } finally { NativeMethods.kuzu_destroy_string(ptr); } } }
 
         // Rel helpers
-        public KuzuValue GetRelIdValue() { lock (_lockObject) { EnsureAliveAndValid(); var st = NativeMethods.kuzu_rel_val_get_id_val(_handle.DangerousGetHandle(), out var h); if (st != KuzuState.Success) throw new KuzuException("Failed to get rel id value"); h.IsOwnedByCpp = true; return CreateBorrowedFromRaw(h); } }
-        public KuzuValue GetRelSrcIdValue() { lock (_lockObject) { EnsureAliveAndValid(); var st = NativeMethods.kuzu_rel_val_get_src_id_val(_handle.DangerousGetHandle(), out var h); if (st != KuzuState.Success) throw new KuzuException("Failed to get rel src id value"); h.IsOwnedByCpp = true; return CreateBorrowedFromRaw(h); } }
-        public KuzuValue GetRelDstIdValue() { lock (_lockObject) { EnsureAliveAndValid(); var st = NativeMethods.kuzu_rel_val_get_dst_id_val(_handle.DangerousGetHandle(), out var h); if (st != KuzuState.Success) throw new KuzuException("Failed to get rel dst id value"); h.IsOwnedByCpp = true; return CreateBorrowedFromRaw(h); } }
-        public KuzuValue GetRelLabelValue() { lock (_lockObject) { EnsureAliveAndValid(); var st = NativeMethods.kuzu_rel_val_get_label_val(_handle.DangerousGetHandle(), out var h); if (st != KuzuState.Success) throw new KuzuException("Failed to get rel label value"); h.IsOwnedByCpp = true; return CreateBorrowedFromRaw(h); } }
-        public ulong GetRelPropertySize() { lock (_lockObject) { EnsureAliveAndValid(); var st = NativeMethods.kuzu_rel_val_get_property_size(_handle.DangerousGetHandle(), out ulong sz); if (st != KuzuState.Success) throw new KuzuException("Failed to get rel property size"); return sz; } }
-        public string GetRelPropertyNameAt(ulong index) { lock (_lockObject) { EnsureAliveAndValid(); var st = NativeMethods.kuzu_rel_val_get_property_name_at(_handle.DangerousGetHandle(), index, out var ptr); if (st != KuzuState.Success) throw new KuzuException($"Failed to get rel property name at index {index}"); if (ptr == IntPtr.Zero) return string.Empty; try { return Marshal.PtrToStringAnsi(ptr) ?? string.Empty; } finally { NativeMethods.kuzu_destroy_string(ptr); } } }
-        public KuzuValue GetRelPropertyValueAt(ulong index) { lock (_lockObject) { EnsureAliveAndValid(); var st = NativeMethods.kuzu_rel_val_get_property_value_at(_handle.DangerousGetHandle(), index, out var h); if (st != KuzuState.Success) throw new KuzuException($"Failed to get rel property value at index {index}"); h.IsOwnedByCpp = true; return CreateBorrowedFromRaw(h); } }
-        public string GetRelString() { lock (_lockObject) { EnsureAliveAndValid(); var st = NativeMethods.kuzu_rel_val_to_string(_handle.DangerousGetHandle(), out var ptr); if (st != KuzuState.Success) throw new KuzuException("Failed to convert rel to string"); if (ptr == IntPtr.Zero) return string.Empty; try { return Marshal.PtrToStringAnsi(ptr) ?? string.Empty; } finally { NativeMethods.kuzu_destroy_string(ptr); } } }
+        public KuzuValue GetRelIdValue() { using (var lease = Lease()) { var st = NativeMethods.kuzu_rel_val_get_id_val(lease.Pointer, out var h); if (st != KuzuState.Success) throw new KuzuException("Failed to get rel id value"); h.IsOwnedByCpp = true; return CreateBorrowedFromRaw(h); } }
+        public KuzuValue GetRelSrcIdValue() { using (var lease = Lease()) { var st = NativeMethods.kuzu_rel_val_get_src_id_val(lease.Pointer, out var h); if (st != KuzuState.Success) throw new KuzuException("Failed to get rel src id value"); h.IsOwnedByCpp = true; return CreateBorrowedFromRaw(h); } }
+        public KuzuValue GetRelDstIdValue() { using (var lease = Lease()) { var st = NativeMethods.kuzu_rel_val_get_dst_id_val(lease.Pointer, out var h); if (st != KuzuState.Success) throw new KuzuException("Failed to get rel dst id value"); h.IsOwnedByCpp = true; return CreateBorrowedFromRaw(h); } }
+        public KuzuValue GetRelLabelValue() { using (var lease = Lease()) { var st = NativeMethods.kuzu_rel_val_get_label_val(lease.Pointer, out var h); if (st != KuzuState.Success) throw new KuzuException("Failed to get rel label value"); h.IsOwnedByCpp = true; return CreateBorrowedFromRaw(h); } }
+        public ulong GetRelPropertySize() { using (var lease = Lease()) { var st = NativeMethods.kuzu_rel_val_get_property_size(lease.Pointer, out ulong sz); if (st != KuzuState.Success) throw new KuzuException("Failed to get rel property size"); return sz; } }
+        public string GetRelPropertyNameAt(ulong index) { using (var lease = Lease()) { var st = NativeMethods.kuzu_rel_val_get_property_name_at(lease.Pointer, index, out var ptr); if (st != KuzuState.Success) throw new KuzuException($"Failed to get rel property name at index {index}"); if (ptr == IntPtr.Zero) return string.Empty; try { return NativeUtil.PtrToStringUtf8(ptr) ?? string.Empty; } finally { NativeMethods.kuzu_destroy_string(ptr); } } }
+        public KuzuValue GetRelPropertyValueAt(ulong index) { using (var lease = Lease()) { var st = NativeMethods.kuzu_rel_val_get_property_value_at(lease.Pointer, index, out var h); if (st != KuzuState.Success) throw new KuzuException($"Failed to get rel property value at index {index}"); h.IsOwnedByCpp = true; return CreateBorrowedFromRaw(h); } }
+        /// <summary>Decodes this rel's ids, label and all properties in one pass; see <see cref="ReadNode"/>.</summary>
+        public KuzuRel ReadRel() { using (var lease = Lease()) return (GraphSchemas ?? new GraphSchemaCache()).ReadRel(lease.Pointer); }
+        public string GetRelString() { using (var lease = Lease()) { var st = NativeMethods.kuzu_rel_val_to_string(lease.Pointer, out var ptr); if (st != KuzuState.Success) throw new KuzuException("Failed to convert rel to string"); if (ptr == IntPtr.Zero) return string.Empty; try { return NativeUtil.PtrToStringUtf8(ptr) ?? string.Empty; } finally { NativeMethods.kuzu_destroy_string(ptr); } } }
 
-        public KuzuValue Clone() { lock (_lockObject) { EnsureAliveAndValid(); var clone = NativeMethods.kuzu_value_clone(_handle.DangerousGetHandle()); if (clone == IntPtr.Zero) throw new KuzuException("Failed to clone value"); return new KuzuValue(new KuzuValueSafeHandle(clone, false, false)); } }
-        public void CopyFrom(KuzuValue other) { lock (_lockObject) { EnsureAliveAndValid(); if (other == null) throw new ArgumentNullException(nameof(other)); other.ThrowIfDisposed(); NativeMethods.kuzu_value_copy(_handle.DangerousGetHandle(), other._handle.DangerousGetHandle()); } }
+        public KuzuValue Clone() { using (var lease = Lease()) { var clone = NativeMethods.kuzu_value_clone(lease.Pointer); if (clone == IntPtr.Zero) throw new KuzuException("Failed to clone value"); return new KuzuValue(new KuzuValueSafeHandle(clone, false, false)); } }
+        public void CopyFrom(KuzuValue other) { if (other == null) throw new ArgumentNullException(nameof(other)); using (var lease = Lease()) using (var source = other.Lease()) NativeMethods.kuzu_value_copy(lease.Pointer, source.Pointer); }
         public string GetDateAsString() => StructToString(GetNativeDate(), NativeMethods.kuzu_date_to_string, "date");
         public string GetBigIntegerAsString() => StructToString(GetNativeInt128(), NativeMethods.kuzu_int128_t_to_string, "int128");
         public string GetInternalIdAsString() => GetInternalId().ToString();
-        public override string ToString() { lock (_lockObject) { if (_handle.IsInvalid) return "[Invalid KuzuValue]"; var ptr = NativeMethods.kuzu_value_to_string(_handle.DangerousGetHandle()); if (ptr == IntPtr.Zero) return string.Empty; try { return Marshal.PtrToStringAnsi(ptr) ?? string.Empty; } finally { NativeMethods.kuzu_destroy_string(ptr); } } }
+        public override string ToString() { if (_handle.IsClosed || _handle.IsInvalid) return "[Invalid KuzuValue]"; using (var lease = Lease()) { var ptr = NativeMethods.kuzu_value_to_string(lease.Pointer); if (ptr == IntPtr.Zero) return string.Empty; try { return NativeUtil.PtrToStringUtf8(ptr) ?? string.Empty; } finally { NativeMethods.kuzu_destroy_string(ptr); } } }
         public void Dispose() { _handle.Dispose(); GC.SuppressFinalize(this); }
 
-        private delegate KuzuState NativeGetter<T>(IntPtr value, out T outVal);
         private delegate KuzuState StructToStringConverter<TStruct>(TStruct val, out IntPtr strPtr);
-        private bool GetPrimitive<T>(string name, NativeGetter<T> getter, out T value) { lock (_lockObject) { EnsureAliveAndValid(); var state = getter(_handle.DangerousGetHandle(), out value); if (state != KuzuState.Success) throw new KuzuException($"Failed to get {name} value - type mismatch or invalid value"); return true; } }
-        private string StructToString<TStruct>(TStruct val, StructToStringConverter<TStruct> converter, string name) { var state = converter(val, out var ptr); if (state != KuzuState.Success) throw new KuzuException($"Failed to convert {name} to string"); if (ptr == IntPtr.Zero) return string.Empty; try { return Marshal.PtrToStringAnsi(ptr) ?? string.Empty; } finally { NativeMethods.kuzu_destroy_string(ptr); } }
-        [MethodImpl(MethodImplOptions.AggressiveInlining)] private void ThrowIfDisposed() { if (_handle.IsInvalid) throw new ObjectDisposedException(nameof(KuzuValue)); }
-        [MethodImpl(MethodImplOptions.AggressiveInlining)] private void ValidateHandle() { if (_handle.IsInvalid) throw new InvalidOperationException("Invalid KuzuValue handle - pointer is null"); }
-        [MethodImpl(MethodImplOptions.AggressiveInlining)] private void EnsureAliveAndValid() { ThrowIfDisposed(); ValidateHandle(); }
+        [MethodImpl(MethodImplOptions.AggressiveInlining)] private static void ThrowIfGetFailed(KuzuState state, string name) { if (state != KuzuState.Success) throw new KuzuException($"Failed to get {name} value - type mismatch or invalid value"); }
+        private string StructToString<TStruct>(TStruct val, StructToStringConverter<TStruct> converter, string name) { var state = converter(val, out var ptr); if (state != KuzuState.Success) throw new KuzuException($"Failed to convert {name} to string"); if (ptr == IntPtr.Zero) return string.Empty; try { return NativeUtil.PtrToStringUtf8(ptr) ?? string.Empty; } finally { NativeMethods.kuzu_destroy_string(ptr); } }
+        [MethodImpl(MethodImplOptions.AggressiveInlining)] private SafeHandleLease Lease() => new SafeHandleLease(_handle, nameof(KuzuValue));
         internal static KuzuValue CreateBorrowedFromRaw(KuzuDot.Native.KuzuValue raw) { int size = Marshal.SizeOf(typeof(KuzuDot.Native.KuzuValue)); var wrapperPtr = Marshal.AllocHGlobal(size); Marshal.StructureToPtr(raw, wrapperPtr, false); return new KuzuValue(new KuzuValueSafeHandle(wrapperPtr, true, true)); }
     }
 }
\ No newline at end of file
@@ -33,4 +33,56 @@ namespace KuzuDot.Native
         public IntPtr release;     // void (*release)(ArrowArray*)
         public IntPtr private_data; // void*
     }
+
+    /// <summary>
+    /// Helpers for honouring the producer-owned release callbacks of the Arrow C Data Interface.
+    /// Structs may be moved (bitwise copied) by the consumer; the callback must then be invoked on the moved copy.
+    /// </summary>
+    internal static class ArrowInterop
+    {
+#if !NET8_0_OR_GREATER
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)] private delegate void ReleaseCallback(IntPtr structPtr);
+#endif
+
+        internal static unsafe void Release(ArrowSchema* schema)
+        {
+            if (schema == null || schema->release == IntPtr.Zero) return;
+            Invoke(schema->release, (IntPtr)schema);
+            schema->release = IntPtr.Zero; // producers must do this too; guard against double release
+        }
+
+        internal static unsafe void Release(ArrowArray* array)
+        {
+            if (array == null || array->release == IntPtr.Zero) return;
+            Invoke(array->release, (IntPtr)array);
+            array->release = IntPtr.Zero;
+        }
+
+        private static unsafe void Invoke(IntPtr release, IntPtr structPtr)
+        {
+#if NET8_0_OR_GREATER
+            ((delegate* unmanaged[Cdecl]<IntPtr, void>)release)(structPtr);
+#else
+            Marshal.GetDelegateForFunctionPointer<ReleaseCallback>(release)(structPtr);
+#endif
+        }
+
+        /// <summary>Returns the size in bytes of one element of a fixed-width format string, or -1 when not fixed-width.</summary>
+        internal static int FixedWidth(string format)
+        {
+            if (string.IsNullOrEmpty(format)) return -1;
+            switch (format)
+            {
+                case "c": case "C": return 1;
+                case "s": case "S": case "e": return 2;
+                case "i": case "I": case "f": case "tdD": case "tts": case "ttm": case "tiM": return 4;
+                case "l": case "L": case "g": case "tdm": case "ttu": case "ttn": case "tDs": case "tDm": case "tDu": case "tDn": case "tiD": return 8;
+                case "tin": return 16;
+            }
+            if (format.StartsWith("ts", StringComparison.Ordinal)) return 8; // timestamps, with or without timezone suffix
+            if (format.StartsWith("d:", StringComparison.Ordinal)) return format.EndsWith(",256", StringComparison.Ordinal) ? 32 : 16;
+            if (format.StartsWith("w:", StringComparison.Ordinal) && int.TryParse(format.Substring(2), out var w)) return w;
+            return -1;
+        }
+    }
 }
@@ -0,0 +1,163 @@
+using System;
+using System.Buffers;
+using System.Runtime.CompilerServices;
+#if NET8_0_OR_GREATER
+using System.Runtime.InteropServices;
+using System.Runtime.Intrinsics;
+#endif
+
+namespace KuzuDot.Native
+{
+    /// <summary>
+    /// Converts between bytes and the engine's BLOB text form, in which printable ASCII stands for itself and every other
+    /// byte (plus <c>\</c>, <c>'</c> and <c>"</c>) is written as <c>\xHH</c>. <c>BLOB(text)</c> and <c>COPY</c> parse that
+    /// form into the raw bytes, and the engine prints BLOB values in it. The C API has no binary blob constructor, and
+    /// <c>kuzu_value_get_blob</c> returns a NUL-terminated buffer that cannot carry embedded zero bytes, so both directions
+    /// go through this text, working directly on native/pooled UTF-8 buffers without intermediate strings.
+    /// </summary>
+    internal static class BlobCodec
+    {
+        private static readonly sbyte[] HexValues = CreateHexTable();
+        private static readonly byte[] HexDigitsUpper = { (byte)'0', (byte)'1', (byte)'2', (byte)'3', (byte)'4', (byte)'5', (byte)'6', (byte)'7', (byte)'8', (byte)'9', (byte)'A', (byte)'B', (byte)'C', (byte)'D', (byte)'E', (byte)'F' };
+
+        private static sbyte[] CreateHexTable()
+        {
+            var table = new sbyte[256];
+            for (int i = 0; i < table.Length; i++) table[i] = -1;
+            for (int i = 0; i < 10; i++) table['0' + i] = (sbyte)i;
+            for (int i = 0; i < 6; i++) { table['a' + i] = (sbyte)(10 + i); table['A' + i] = (sbyte)(10 + i); }
+            return table;
+        }
+
+        /// <summary>True for bytes the text form writes as themselves.</summary>
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public static bool IsLiteral(byte b) => b >= 0x20 && b <= 0x7E && b != '\\' && b != '\'' && b != '"';
+
+        public static byte HexDigit(int nibble) => HexDigitsUpper[nibble];
+
+        /// <summary>Gets the number of bytes <paramref name="text"/> decodes to.</summary>
+        public static int GetDecodedLength(ReadOnlySpan<byte> text)
+        {
+#if NET8_0_OR_GREATER
+            // Every escape is four bytes, so a vectorized count of backslashes gives the length; a truncated trailing
+            // escape is rejected here and any other malformed escape by Decode.
+            if (text.Slice(Math.Max(0, text.Length - 3)).IndexOf((byte)'\\') >= 0) throw InvalidText();
+            return text.Length - 3 * text.Count((byte)'\\');
+#else
+            int length = text.Length;
+            int escape;
+            while ((escape = text.IndexOf((byte)'\\')) >= 0)
+            {
+                length -= 3;
+                if (text.Length - escape < 4) throw InvalidText();
+                text = text.Slice(escape + 4);
+            }
+            return length;
+#endif
+        }
+
+        /// <summary>
+        /// Decodes <paramref name="text"/> into <paramref name="destination"/>, which must hold <see cref="GetDecodedLength"/>
+        /// bytes, and returns the number written. Literal runs are located with a vectorized search and block-copied; on .NET 8
+        /// runs of escapes (the bulk of binary data) are decoded four at a time with <c>Vector128</c> when accelerated.
+        /// </summary>
+        public static int Decode(ReadOnlySpan<byte> text, Span<byte> destination)
+        {
+            var table = HexValues;
+            int written = 0;
+            while (!text.IsEmpty)
+            {
+                int escape = text.IndexOf((byte)'\\');
+                var literal = escape < 0 ? text : text.Slice(0, escape);
+                literal.CopyTo(destination.Slice(written));
+                written += literal.Length;
+                if (escape < 0) break;
+                text = text.Slice(escape);
+#if NET8_0_OR_GREATER
+                if (Vector128.IsHardwareAccelerated && BitConverter.IsLittleEndian)
+                {
+                    while (text.Length >= 16 && destination.Length - written >= 4 && TryDecodeFourEscapes(text, destination.Slice(written)))
+                    {
+                        written += 4;
+                        text = text.Slice(16);
+                    }
+                    if (text.IsEmpty || text[0] != '\\') continue;
+                }
+#endif
+                if (text.Length < 4 || (text[1] | 0x20) != 'x') throw InvalidText();
+                int hi = table[text[2]], lo = table[text[3]];
+                if ((hi | lo) < 0) throw InvalidText();
+                destination[written++] = (byte)((hi << 4) | lo);
+                text = text.Slice(4);
+            }
+            return written;
+        }
+
+#if NET8_0_OR_GREATER
+        /// <summary>
+        /// Decodes <c>\xHH\xHH\xHH\xHH</c> from the first 16 bytes of <paramref name="text"/> into four bytes; false (nothing
+        /// written) when those bytes are not four well-formed escapes, leaving the caller to take the scalar path.
+        /// </summary>
+        private static bool TryDecodeFourEscapes(ReadOnlySpan<byte> text, Span<byte> destination)
+        {
+            var v = Vector128.Create(text);
+            // Per 4-byte group (little-endian lanes): '\' then 'x' (case-folded), followed by two hex digits.
+            var prefixMask = Vector128.Create(0x0000FFFFu).AsByte();
+            if (!Vector128.EqualsAll((v | Vector128.Create(0x00002000u).AsByte()) & prefixMask, Vector128.Create(0x0000785Cu).AsByte())) return false;
+
+            var digit = v - Vector128.Create((byte)'0');
+            var letter = (v | Vector128.Create((byte)0x20)) - Vector128.Create((byte)'a');
+            var isDigit = Vector128.LessThan(digit, Vector128.Create((byte)10));
+            var isLetter = Vector128.LessThan(letter, Vector128.Create((byte)6));
+            if (!Vector128.EqualsAll(isDigit | isLetter | prefixMask, Vector128<byte>.AllBitsSet)) return false;
+
+            var nibbles = Vector128.ConditionalSelect(isDigit, digit, letter + Vector128.Create((byte)10));
+            var hi = Vector128.Shuffle(nibbles, Vector128.Create(0x0E0A0602u, 0x80808080u, 0x80808080u, 0x80808080u).AsByte());
+            var lo = Vector128.Shuffle(nibbles, Vector128.Create(0x0F0B0703u, 0x80808080u, 0x80808080u, 0x80808080u).AsByte());
+            var decoded = (Vector128.ShiftLeft(hi, 4) | lo).AsUInt32().ToScalar();
+            MemoryMarshal.Write(destination, in decoded);
+            return true;
+        }
+#endif
+
+        public static byte[] Decode(ReadOnlySpan<byte> text)
+        {
+            var length = GetDecodedLength(text);
+            if (length == 0) return Array.Empty<byte>();
+            var bytes = new byte[length];
+            Decode(text, bytes);
+            return bytes;
+        }
+
+        /// <summary>
+        /// Writes <paramref name="data"/> as null-terminated BLOB text into <paramref name="scratch"/> when it fits,
+        /// otherwise into a pooled array handed back through <paramref name="rented"/> (release with <see cref="NativeUtil.Return"/>).
+        /// </summary>
+        public static ReadOnlySpan<byte> EncodeNullTerminated(ReadOnlySpan<byte> data, Span<byte> scratch, out byte[] rented)
+        {
+            rented = null;
+            long length = data.Length + 1L;
+            for (int i = 0; i < data.Length; i++)
+            {
+                if (!IsLiteral(data[i])) length += 3;
+            }
+            if (length > int.MaxValue) throw new ArgumentException("Blob is too large to encode", nameof(data));
+            var buffer = length <= scratch.Length ? scratch : (rented = ArrayPool<byte>.Shared.Rent((int)length));
+            int j = 0;
+            for (int i = 0; i < data.Length; i++)
+            {
+                var b = data[i];
+                if (IsLiteral(b)) { buffer[j++] = b; continue; }
+                buffer[j] = (byte)'\\';
+                buffer[j + 1] = (byte)'x';
+                buffer[j + 2] = HexDigitsUpper[b >> 4];
+                buffer[j + 3] = HexDigitsUpper[b & 0xF];
+                j += 4;
+            }
+            buffer[j] = 0;
+            return buffer.Slice(0, j + 1);
+        }
+
+        private static KuzuException InvalidText() => new KuzuException("Invalid blob text returned from native layer");
+    }
+}
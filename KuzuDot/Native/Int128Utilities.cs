@@ -38,7 +38,7 @@ namespace KuzuDot.Native
             {
                 throw new KuzuException("Failed to convert Int128 to string");
             }
-            try { return Marshal.PtrToStringAnsi(strPtr) ?? string.Empty; }
+            try { return NativeUtil.PtrToStringUtf8(strPtr) ?? string.Empty; }
             finally { NativeMethods.kuzu_destroy_string(strPtr); }
         }
 
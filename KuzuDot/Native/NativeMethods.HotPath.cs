@@ -0,0 +1,426 @@
+using System;
+using System.Runtime.InteropServices;
+#if NET8_0_OR_GREATER
+using System.Runtime.CompilerServices;
+#endif
+using KuzuDot.Native.Enums;
+
+namespace KuzuDot.Native
+{
+    /// <summary>
+    /// Per-row / per-cell / per-bind entry points. On net8.0 these are source-generated <c>LibraryImport</c> stubs over
+    /// blittable signatures, and trivial getters skip the GC transition; netstandard2.0 falls back to classic DllImport.
+    /// </summary>
+    internal static partial class NativeMethods
+    {
+#if NET8_0_OR_GREATER
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        internal static partial KuzuState kuzu_connection_execute(ref KuzuConnection connection,
+            ref KuzuPreparedStatement preparedStatement, out KuzuQueryResult outQueryResult);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        internal static partial KuzuState kuzu_prepared_statement_bind_bool(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, [MarshalAs(UnmanagedType.U1)] bool value);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        internal static partial KuzuState kuzu_prepared_statement_bind_int64(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, long value);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        internal static partial KuzuState kuzu_prepared_statement_bind_int32(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, int value);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        internal static partial KuzuState kuzu_prepared_statement_bind_int16(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, short value);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        internal static partial KuzuState kuzu_prepared_statement_bind_int8(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, sbyte value);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        internal static partial KuzuState kuzu_prepared_statement_bind_uint64(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, ulong value);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        internal static partial KuzuState kuzu_prepared_statement_bind_uint32(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, uint value);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        internal static partial KuzuState kuzu_prepared_statement_bind_uint16(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, ushort value);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        internal static partial KuzuState kuzu_prepared_statement_bind_uint8(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, byte value);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        internal static partial KuzuState kuzu_prepared_statement_bind_double(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, double value);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        internal static partial KuzuState kuzu_prepared_statement_bind_float(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, float value);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        internal static partial KuzuState kuzu_prepared_statement_bind_date(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, KuzuDate value);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        internal static partial KuzuState kuzu_prepared_statement_bind_timestamp(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, KuzuTimestamp value);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        internal static partial KuzuState kuzu_prepared_statement_bind_timestamp_ns(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, KuzuTimestampNs value);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        internal static partial KuzuState kuzu_prepared_statement_bind_timestamp_ms(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, KuzuTimestampMs value);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        internal static partial KuzuState kuzu_prepared_statement_bind_timestamp_sec(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, KuzuTimestampSec value);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        internal static partial KuzuState kuzu_prepared_statement_bind_timestamp_tz(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, KuzuTimestampTz value);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        internal static partial KuzuState kuzu_prepared_statement_bind_interval(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, KuzuInterval value);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        internal static partial KuzuState kuzu_prepared_statement_bind_string(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, IntPtr value);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        internal static partial KuzuState kuzu_prepared_statement_bind_value(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, IntPtr value);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        internal static partial void kuzu_query_result_destroy(ref KuzuQueryResult queryResult);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        [return: MarshalAs(UnmanagedType.I1)]
+        internal static partial bool kuzu_query_result_is_success(ref KuzuQueryResult queryResult);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        internal static partial ulong kuzu_query_result_get_num_tuples(ref KuzuQueryResult queryResult);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [return: MarshalAs(UnmanagedType.I1)]
+        internal static partial bool kuzu_query_result_has_next(ref KuzuQueryResult queryResult);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        internal static partial KuzuState kuzu_query_result_get_next(ref KuzuQueryResult queryResult, out KuzuFlatTuple outFlatTuple);
+
+        // Not a trivial getter: an out-of-range index throws and catches a C++ exception, which must not run in cooperative mode.
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        internal static partial KuzuState kuzu_flat_tuple_get_value(ref KuzuFlatTuple flatTuple, ulong index, out KuzuValue outValue);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        [return: MarshalAs(UnmanagedType.I1)]
+        internal static partial bool kuzu_value_is_null(IntPtr value);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        internal static partial KuzuState kuzu_value_get_bool(IntPtr value, [MarshalAs(UnmanagedType.U1)] out bool outResult);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        internal static partial KuzuState kuzu_value_get_int8(IntPtr value, out sbyte outResult);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        internal static partial KuzuState kuzu_value_get_int16(IntPtr value, out short outResult);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        internal static partial KuzuState kuzu_value_get_int32(IntPtr value, out int outResult);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        internal static partial KuzuState kuzu_value_get_int64(IntPtr value, out long outResult);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        internal static partial KuzuState kuzu_value_get_uint8(IntPtr value, out byte outResult);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        internal static partial KuzuState kuzu_value_get_uint16(IntPtr value, out ushort outResult);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        internal static partial KuzuState kuzu_value_get_uint32(IntPtr value, out uint outResult);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        internal static partial KuzuState kuzu_value_get_uint64(IntPtr value, out ulong outResult);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        internal static partial KuzuState kuzu_value_get_int128(IntPtr value, out KuzuInt128 outResult);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        internal static partial KuzuState kuzu_value_get_float(IntPtr value, out float outResult);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        internal static partial KuzuState kuzu_value_get_double(IntPtr value, out double outResult);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        internal static partial KuzuState kuzu_value_get_internal_id(IntPtr value, out KuzuInternalIdNative outResult);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        internal static partial KuzuState kuzu_value_get_date(IntPtr value, out KuzuDate outResult);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        internal static partial KuzuState kuzu_value_get_timestamp(IntPtr value, out KuzuTimestamp outResult);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        internal static partial KuzuState kuzu_value_get_timestamp_ns(IntPtr value, out KuzuTimestampNs outResult);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        internal static partial KuzuState kuzu_value_get_timestamp_ms(IntPtr value, out KuzuTimestampMs outResult);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        internal static partial KuzuState kuzu_value_get_timestamp_sec(IntPtr value, out KuzuTimestampSec outResult);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        internal static partial KuzuState kuzu_value_get_timestamp_tz(IntPtr value, out KuzuTimestampTz outResult);
+
+        [LibraryImport(DllName)]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        internal static partial KuzuState kuzu_value_get_interval(IntPtr value, out KuzuInterval outResult);
+#else
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_connection_execute(ref KuzuConnection connection,
+            ref KuzuPreparedStatement preparedStatement, out KuzuQueryResult outQueryResult);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_prepared_statement_bind_bool(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, [MarshalAs(UnmanagedType.U1)] bool value);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_prepared_statement_bind_int64(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, long value);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_prepared_statement_bind_int32(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, int value);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_prepared_statement_bind_int16(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, short value);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_prepared_statement_bind_int8(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, sbyte value);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_prepared_statement_bind_uint64(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, ulong value);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_prepared_statement_bind_uint32(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, uint value);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_prepared_statement_bind_uint16(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, ushort value);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_prepared_statement_bind_uint8(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, byte value);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_prepared_statement_bind_double(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, double value);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_prepared_statement_bind_float(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, float value);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_prepared_statement_bind_date(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, KuzuDate value);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_prepared_statement_bind_timestamp(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, KuzuTimestamp value);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_prepared_statement_bind_timestamp_ns(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, KuzuTimestampNs value);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_prepared_statement_bind_timestamp_ms(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, KuzuTimestampMs value);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_prepared_statement_bind_timestamp_sec(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, KuzuTimestampSec value);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_prepared_statement_bind_timestamp_tz(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, KuzuTimestampTz value);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_prepared_statement_bind_interval(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, KuzuInterval value);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_prepared_statement_bind_string(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, IntPtr value);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_prepared_statement_bind_value(ref KuzuPreparedStatement preparedStatement,
+            IntPtr paramName, IntPtr value);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void kuzu_query_result_destroy(ref KuzuQueryResult queryResult);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        internal static extern bool kuzu_query_result_is_success(ref KuzuQueryResult queryResult);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern ulong kuzu_query_result_get_num_tuples(ref KuzuQueryResult queryResult);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        internal static extern bool kuzu_query_result_has_next(ref KuzuQueryResult queryResult);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_query_result_get_next(ref KuzuQueryResult queryResult, out KuzuFlatTuple outFlatTuple);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_flat_tuple_get_value(ref KuzuFlatTuple flatTuple, ulong index, out KuzuValue outValue);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        internal static extern bool kuzu_value_is_null(IntPtr value);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_value_get_bool(IntPtr value, [MarshalAs(UnmanagedType.U1)] out bool outResult);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_value_get_int8(IntPtr value, out sbyte outResult);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_value_get_int16(IntPtr value, out short outResult);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_value_get_int32(IntPtr value, out int outResult);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_value_get_int64(IntPtr value, out long outResult);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_value_get_uint8(IntPtr value, out byte outResult);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_value_get_uint16(IntPtr value, out ushort outResult);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_value_get_uint32(IntPtr value, out uint outResult);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_value_get_uint64(IntPtr value, out ulong outResult);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_value_get_int128(IntPtr value, out KuzuInt128 outResult);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_value_get_float(IntPtr value, out float outResult);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_value_get_double(IntPtr value, out double outResult);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_value_get_internal_id(IntPtr value, out KuzuInternalIdNative outResult);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_value_get_date(IntPtr value, out KuzuDate outResult);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_value_get_timestamp(IntPtr value, out KuzuTimestamp outResult);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_value_get_timestamp_ns(IntPtr value, out KuzuTimestampNs outResult);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_value_get_timestamp_ms(IntPtr value, out KuzuTimestampMs outResult);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_value_get_timestamp_sec(IntPtr value, out KuzuTimestampSec outResult);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_value_get_timestamp_tz(IntPtr value, out KuzuTimestampTz outResult);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_value_get_interval(IntPtr value, out KuzuInterval outResult);
+#endif
+    }
+}
@@ -9,13 +9,13 @@ namespace KuzuDot.Native
     /// Wrapper for Native Kuzu methods via P/Invoke
     /// See libkuzu/kuzu.h for reference
     /// </summary>
-    internal static class NativeMethods
+    internal static partial class NativeMethods
     {
         private const string DllName = "kuzu_shared.dll";
 
         // Database functions
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
-        internal static extern KuzuState kuzu_database_init([MarshalAs(UnmanagedType.LPStr)] string databasePath,
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_database_init([MarshalAs(UnmanagedType.LPUTF8Str)] string databasePath,
             KuzuSystemConfig systemConfig, out KuzuDatabase outDatabase);
 
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
@@ -37,17 +37,22 @@ namespace KuzuDot.Native
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         internal static extern KuzuState kuzu_connection_get_max_num_thread_for_exec(ref KuzuConnection connection, out ulong outResult);
 
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         internal static extern KuzuState kuzu_connection_query(ref KuzuConnection connection,
-            [MarshalAs(UnmanagedType.LPStr)] string query, out KuzuQueryResult outQueryResult);
+            [MarshalAs(UnmanagedType.LPUTF8Str)] string query, out KuzuQueryResult outQueryResult);
 
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         internal static extern KuzuState kuzu_connection_prepare(ref KuzuConnection connection,
-            [MarshalAs(UnmanagedType.LPStr)] string query, out KuzuPreparedStatement outPreparedStatement);
+            [MarshalAs(UnmanagedType.LPUTF8Str)] string query, out KuzuPreparedStatement outPreparedStatement);
+
+        // Pre-encoded (null-terminated UTF-8) query text
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_connection_query(ref KuzuConnection connection,
+            IntPtr query, out KuzuQueryResult outQueryResult);
 
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern KuzuState kuzu_connection_execute(ref KuzuConnection connection,
-            ref KuzuPreparedStatement preparedStatement, out KuzuQueryResult outQueryResult);
+        internal static extern KuzuState kuzu_connection_prepare(ref KuzuConnection connection,
+            IntPtr query, out KuzuPreparedStatement outPreparedStatement);
 
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         internal static extern void kuzu_connection_interrupt(ref KuzuConnection connection);
@@ -66,95 +71,12 @@ namespace KuzuDot.Native
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         internal static extern IntPtr kuzu_prepared_statement_get_error_message(ref KuzuPreparedStatement preparedStatement);
 
-        // Prepared Statement bind functions - all data types
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
-        internal static extern KuzuState kuzu_prepared_statement_bind_bool(ref KuzuPreparedStatement preparedStatement,
-            [MarshalAs(UnmanagedType.LPStr)] string paramName, bool value);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
-        internal static extern KuzuState kuzu_prepared_statement_bind_int64(ref KuzuPreparedStatement preparedStatement,
-            [MarshalAs(UnmanagedType.LPStr)] string paramName, long value);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
-        internal static extern KuzuState kuzu_prepared_statement_bind_int32(ref KuzuPreparedStatement preparedStatement,
-            [MarshalAs(UnmanagedType.LPStr)] string paramName, int value);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
-        internal static extern KuzuState kuzu_prepared_statement_bind_int16(ref KuzuPreparedStatement preparedStatement,
-            [MarshalAs(UnmanagedType.LPStr)] string paramName, short value);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
-        internal static extern KuzuState kuzu_prepared_statement_bind_int8(ref KuzuPreparedStatement preparedStatement,
-            [MarshalAs(UnmanagedType.LPStr)] string paramName, sbyte value);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
-        internal static extern KuzuState kuzu_prepared_statement_bind_uint64(ref KuzuPreparedStatement preparedStatement,
-            [MarshalAs(UnmanagedType.LPStr)] string paramName, ulong value);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
-        internal static extern KuzuState kuzu_prepared_statement_bind_uint32(ref KuzuPreparedStatement preparedStatement,
-            [MarshalAs(UnmanagedType.LPStr)] string paramName, uint value);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
-        internal static extern KuzuState kuzu_prepared_statement_bind_uint16(ref KuzuPreparedStatement preparedStatement,
-            [MarshalAs(UnmanagedType.LPStr)] string paramName, ushort value);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
-        internal static extern KuzuState kuzu_prepared_statement_bind_uint8(ref KuzuPreparedStatement preparedStatement,
-            [MarshalAs(UnmanagedType.LPStr)] string paramName, byte value);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
-        internal static extern KuzuState kuzu_prepared_statement_bind_double(ref KuzuPreparedStatement preparedStatement,
-            [MarshalAs(UnmanagedType.LPStr)] string paramName, double value);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
-        internal static extern KuzuState kuzu_prepared_statement_bind_float(ref KuzuPreparedStatement preparedStatement,
-            [MarshalAs(UnmanagedType.LPStr)] string paramName, float value);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
-        internal static extern KuzuState kuzu_prepared_statement_bind_date(ref KuzuPreparedStatement preparedStatement,
-            [MarshalAs(UnmanagedType.LPStr)] string paramName, KuzuDate value);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
-        internal static extern KuzuState kuzu_prepared_statement_bind_timestamp(ref KuzuPreparedStatement preparedStatement,
-            [MarshalAs(UnmanagedType.LPStr)] string paramName, KuzuTimestamp value);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
-        internal static extern KuzuState kuzu_prepared_statement_bind_timestamp_ns(ref KuzuPreparedStatement preparedStatement,
-            [MarshalAs(UnmanagedType.LPStr)] string paramName, KuzuTimestampNs value);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
-        internal static extern KuzuState kuzu_prepared_statement_bind_timestamp_ms(ref KuzuPreparedStatement preparedStatement,
-            [MarshalAs(UnmanagedType.LPStr)] string paramName, KuzuTimestampMs value);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
-        internal static extern KuzuState kuzu_prepared_statement_bind_timestamp_sec(ref KuzuPreparedStatement preparedStatement,
-            [MarshalAs(UnmanagedType.LPStr)] string paramName, KuzuTimestampSec value);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
-        internal static extern KuzuState kuzu_prepared_statement_bind_timestamp_tz(ref KuzuPreparedStatement preparedStatement,
-            [MarshalAs(UnmanagedType.LPStr)] string paramName, KuzuTimestampTz value);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
-        internal static extern KuzuState kuzu_prepared_statement_bind_interval(ref KuzuPreparedStatement preparedStatement,
-            [MarshalAs(UnmanagedType.LPStr)] string paramName, KuzuInterval value);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        // Prepared Statement bind functions with managed string values (see NativeMethods.HotPath.cs for the rest)
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         internal static extern KuzuState kuzu_prepared_statement_bind_string(ref KuzuPreparedStatement preparedStatement,
-            [MarshalAs(UnmanagedType.LPStr)] string paramName, [MarshalAs(UnmanagedType.LPStr)] string value);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
-        internal static extern KuzuState kuzu_prepared_statement_bind_value(ref KuzuPreparedStatement preparedStatement,
-            [MarshalAs(UnmanagedType.LPStr)] string paramName, IntPtr value);
+            IntPtr paramName, [MarshalAs(UnmanagedType.LPUTF8Str)] string value);
 
         // Query Result functions
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void kuzu_query_result_destroy(ref KuzuQueryResult queryResult);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
-        [return: MarshalAs(UnmanagedType.I1)]
-        internal static extern bool kuzu_query_result_is_success(ref KuzuQueryResult queryResult);
-
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         internal static extern IntPtr kuzu_query_result_get_error_message(ref KuzuQueryResult queryResult);
 
@@ -169,16 +91,6 @@ namespace KuzuDot.Native
         internal static extern KuzuState kuzu_query_result_get_column_data_type(ref KuzuQueryResult queryResult,
             ulong index, out KuzuLogicalTypeNative outColumnDataType);
 
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern ulong kuzu_query_result_get_num_tuples(ref KuzuQueryResult queryResult);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
-        [return: MarshalAs(UnmanagedType.I1)]
-        internal static extern bool kuzu_query_result_has_next(ref KuzuQueryResult queryResult);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern KuzuState kuzu_query_result_get_next(ref KuzuQueryResult queryResult, out KuzuFlatTuple outFlatTuple);
-
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         [return: MarshalAs(UnmanagedType.I1)]
         internal static extern bool kuzu_query_result_has_next_query_result(ref KuzuQueryResult queryResult);
@@ -210,9 +122,6 @@ namespace KuzuDot.Native
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         internal static extern void kuzu_flat_tuple_destroy(ref KuzuFlatTuple flatTuple);
 
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern KuzuState kuzu_flat_tuple_get_value(ref KuzuFlatTuple flatTuple, ulong index, out KuzuValue outValue);
-
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         internal static extern IntPtr kuzu_flat_tuple_to_string(ref KuzuFlatTuple flatTuple);
 
@@ -307,8 +216,11 @@ namespace KuzuDot.Native
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         internal static extern IntPtr kuzu_value_create_interval(KuzuInterval value);
 
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
-        internal static extern IntPtr kuzu_value_create_string([MarshalAs(UnmanagedType.LPStr)] string value);
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern IntPtr kuzu_value_create_string([MarshalAs(UnmanagedType.LPUTF8Str)] string value);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern IntPtr kuzu_value_create_string(IntPtr value);
 
         // Collections / structured value creation
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
@@ -321,77 +233,12 @@ namespace KuzuDot.Native
         internal static extern KuzuState kuzu_value_create_map(ulong numFields, IntPtr keys /* kuzu_value** */, IntPtr values /* kuzu_value** */, out IntPtr outValue /* kuzu_value** */);
 
         // Value accessor functions - adding safety checks for IntPtr validation
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
-        [return: MarshalAs(UnmanagedType.I1)]
-        internal static extern bool kuzu_value_is_null(IntPtr value);
-
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         internal static extern void kuzu_value_set_null(IntPtr value, bool isNull);
 
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         internal static extern void kuzu_value_get_data_type(IntPtr value, out KuzuLogicalTypeNative outType);
 
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern KuzuState kuzu_value_get_bool(IntPtr value, out bool outResult);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern KuzuState kuzu_value_get_int8(IntPtr value, out sbyte outResult);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern KuzuState kuzu_value_get_int16(IntPtr value, out short outResult);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern KuzuState kuzu_value_get_int32(IntPtr value, out int outResult);
-
-        // Fixed: Ensure proper marshaling for int64 to prevent memory access violations
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern KuzuState kuzu_value_get_int64(IntPtr value, out long outResult);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern KuzuState kuzu_value_get_uint8(IntPtr value, out byte outResult);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern KuzuState kuzu_value_get_uint16(IntPtr value, out ushort outResult);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern KuzuState kuzu_value_get_uint32(IntPtr value, out uint outResult);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern KuzuState kuzu_value_get_uint64(IntPtr value, out ulong outResult);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern KuzuState kuzu_value_get_int128(IntPtr value, out KuzuInt128 outResult);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern KuzuState kuzu_value_get_float(IntPtr value, out float outResult);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern KuzuState kuzu_value_get_double(IntPtr value, out double outResult);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern KuzuState kuzu_value_get_internal_id(IntPtr value, out KuzuInternalIdNative outResult);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern KuzuState kuzu_value_get_date(IntPtr value, out KuzuDate outResult);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern KuzuState kuzu_value_get_timestamp(IntPtr value, out KuzuTimestamp outResult);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern KuzuState kuzu_value_get_timestamp_ns(IntPtr value, out KuzuTimestampNs outResult);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern KuzuState kuzu_value_get_timestamp_ms(IntPtr value, out KuzuTimestampMs outResult);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern KuzuState kuzu_value_get_timestamp_sec(IntPtr value, out KuzuTimestampSec outResult);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern KuzuState kuzu_value_get_timestamp_tz(IntPtr value, out KuzuTimestampTz outResult);
-
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern KuzuState kuzu_value_get_interval(IntPtr value, out KuzuInterval outResult);
-
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         internal static extern KuzuState kuzu_value_get_string(IntPtr value, out IntPtr outResult);
 
@@ -496,8 +343,8 @@ namespace KuzuDot.Native
         internal static extern IntPtr kuzu_value_to_string(IntPtr value);
 
         // Int128 utility functions
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
-        internal static extern KuzuState kuzu_int128_t_from_string([MarshalAs(UnmanagedType.LPStr)] string str, out KuzuInt128 outResult);
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_int128_t_from_string([MarshalAs(UnmanagedType.LPUTF8Str)] string str, out KuzuInt128 outResult);
 
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         internal static extern KuzuState kuzu_int128_t_to_string(KuzuInt128 val, out IntPtr outResult);
@@ -506,8 +353,8 @@ namespace KuzuDot.Native
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         internal static extern KuzuState kuzu_date_to_string(KuzuDate date, out IntPtr outResult);
 
-        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
-        internal static extern KuzuState kuzu_date_from_string([MarshalAs(UnmanagedType.LPStr)] string str, out KuzuDate outResult);
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern KuzuState kuzu_date_from_string([MarshalAs(UnmanagedType.LPUTF8Str)] string str, out KuzuDate outResult);
 
         // Timestamp/date <-> tm conversion
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
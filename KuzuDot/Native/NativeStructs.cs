@@ -21,9 +21,10 @@ namespace KuzuDot.Native
     [StructLayout(LayoutKind.Sequential)] internal struct KuzuDatabase { public IntPtr Database; }
     [StructLayout(LayoutKind.Sequential)] internal struct KuzuConnection { public IntPtr Connection; }
     [StructLayout(LayoutKind.Sequential)] internal struct KuzuPreparedStatement { public IntPtr PreparedStatement; public IntPtr BoundValues; }
-    [StructLayout(LayoutKind.Sequential)] internal struct KuzuQueryResult { public IntPtr QueryResult; [MarshalAs(UnmanagedType.U1)] public bool IsOwnedByCpp; }
-    [StructLayout(LayoutKind.Sequential)] internal struct KuzuFlatTuple { public IntPtr FlatTuple; [MarshalAs(UnmanagedType.U1)] public bool IsOwnedByCpp; }
-    [StructLayout(LayoutKind.Sequential)] internal struct KuzuValue { public IntPtr Value; [MarshalAs(UnmanagedType.U1)] public bool IsOwnedByCpp; }
+    // Handle structs keep C's one-byte bool as a byte field so they stay blittable for source-generated interop.
+    [StructLayout(LayoutKind.Sequential)] internal struct KuzuQueryResult { public IntPtr QueryResult; private byte _isOwnedByCpp; public bool IsOwnedByCpp { get => _isOwnedByCpp != 0; set => _isOwnedByCpp = value ? (byte)1 : (byte)0; } }
+    [StructLayout(LayoutKind.Sequential)] internal struct KuzuFlatTuple { public IntPtr FlatTuple; private byte _isOwnedByCpp; public bool IsOwnedByCpp { get => _isOwnedByCpp != 0; set => _isOwnedByCpp = value ? (byte)1 : (byte)0; } }
+    [StructLayout(LayoutKind.Sequential)] internal struct KuzuValue { public IntPtr Value; private byte _isOwnedByCpp; public bool IsOwnedByCpp { get => _isOwnedByCpp != 0; set => _isOwnedByCpp = value ? (byte)1 : (byte)0; } }
 
     // Now internal native logical type (wrapped by public DataType)
     [StructLayout(LayoutKind.Sequential)] internal struct KuzuLogicalTypeNative { public IntPtr DataType; }
@@ -1,4 +1,7 @@
 using System;
+using System.Buffers;
+using System.Runtime.InteropServices;
+using System.Text;
 
 namespace KuzuDot.Native
 {
@@ -7,8 +10,65 @@ namespace KuzuDot.Native
         public static string PtrToStringAndDestroy(IntPtr ptr, Action<IntPtr> destroy)
         {
             if (ptr == IntPtr.Zero) return string.Empty;
-            try { return System.Runtime.InteropServices.Marshal.PtrToStringAnsi(ptr) ?? string.Empty; }
+            try { return PtrToStringUtf8(ptr) ?? string.Empty; }
             finally { destroy(ptr); }
         }
+
+        /// <summary>Decodes a null-terminated UTF-8 string; returns null for a null pointer.</summary>
+        public static unsafe string PtrToStringUtf8(IntPtr ptr)
+        {
+#if NET8_0_OR_GREATER
+            return Marshal.PtrToStringUTF8(ptr);
+#else
+            if (ptr == IntPtr.Zero) return null;
+            var span = Utf8Span(ptr);
+            if (span.IsEmpty) return string.Empty;
+            fixed (byte* p = span) return Encoding.UTF8.GetString(p, span.Length);
+#endif
+        }
+
+        /// <summary>Copies <paramref name="value"/> into a null-terminated UTF-8 HGlobal buffer; free it with <see cref="Marshal.FreeHGlobal"/>.</summary>
+        public static unsafe IntPtr StringToHGlobalUtf8(string value)
+        {
+            if (value == null) return IntPtr.Zero;
+            var byteCount = Encoding.UTF8.GetByteCount(value);
+            var ptr = Marshal.AllocHGlobal(byteCount + 1);
+            fixed (char* chars = value) Encoding.UTF8.GetBytes(chars, value.Length, (byte*)ptr, byteCount);
+            ((byte*)ptr)[byteCount] = 0;
+            return ptr;
+        }
+
+        /// <summary>Views a null-terminated native UTF-8 string (without the terminator) as a span.</summary>
+        public static unsafe ReadOnlySpan<byte> Utf8Span(IntPtr ptr)
+        {
+            if (ptr == IntPtr.Zero) return default;
+#if NET8_0_OR_GREATER
+            return MemoryMarshal.CreateReadOnlySpanFromNullTerminated((byte*)ptr);
+#else
+            var p = (byte*)ptr;
+            int length = 0;
+            while (p[length] != 0) length++;
+            return new ReadOnlySpan<byte>(p, length);
+#endif
+        }
+
+        /// <summary>
+        /// Returns <paramref name="utf8"/> as a null-terminated buffer: as-is when it already ends in NUL, otherwise copied into
+        /// <paramref name="scratch"/> when it fits or into a pooled array handed back through <paramref name="rented"/>.
+        /// </summary>
+        public static ReadOnlySpan<byte> NullTerminate(ReadOnlySpan<byte> utf8, Span<byte> scratch, out byte[] rented)
+        {
+            rented = null;
+            if (!utf8.IsEmpty && utf8[utf8.Length - 1] == 0) return utf8;
+            var buffer = utf8.Length < scratch.Length ? scratch : (rented = ArrayPool<byte>.Shared.Rent(utf8.Length + 1));
+            utf8.CopyTo(buffer);
+            buffer[utf8.Length] = 0;
+            return buffer.Slice(0, utf8.Length + 1);
+        }
+
+        public static void Return(byte[] rented)
+        {
+            if (rented != null) ArrayPool<byte>.Shared.Return(rented);
+        }
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,39 @@
+using System;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+
+namespace KuzuDot.Native
+{
+    /// <summary>
+    /// Keeps a <see cref="SafeHandle"/> alive for the duration of a native call by taking a reference on it
+    /// (<see cref="SafeHandle.DangerousAddRef"/>). A concurrent Dispose then defers the native release until the lease
+    /// ends instead of freeing memory under the call, which is all the protection the value accessors need; no monitor
+    /// is taken. Use with <c>using</c>.
+    /// </summary>
+    internal readonly ref struct SafeHandleLease
+    {
+        private readonly SafeHandle _handle;
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        internal SafeHandleLease(SafeHandle handle, string objectName)
+        {
+            bool added = false;
+            try { handle.DangerousAddRef(ref added); }
+            catch (ObjectDisposedException) { throw new ObjectDisposedException(objectName); }
+            var pointer = handle.DangerousGetHandle();
+            if (pointer == IntPtr.Zero)
+            {
+                handle.DangerousRelease();
+                throw new ObjectDisposedException(objectName);
+            }
+            _handle = handle;
+            Pointer = pointer;
+        }
+
+        /// <summary>The native pointer, valid until the lease is disposed.</summary>
+        public IntPtr Pointer { get; }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public void Dispose() => _handle?.DangerousRelease();
+    }
+}
@@ -0,0 +1,85 @@
+using System;
+using KuzuDot.Native.Enums;
+
+namespace KuzuDot.Native
+{
+    /// <summary>
+    /// Decodes borrowed native values straight into CLR objects, given their type id up front, so bulk readers
+    /// (node/rel properties) need no <see cref="KuzuDot.KuzuValue"/> wrapper or per-value type lookup.
+    /// </summary>
+    internal static class ValueDecoder
+    {
+        public static KuzuDataTypeId GetTypeId(IntPtr value)
+        {
+            NativeMethods.kuzu_value_get_data_type(value, out KuzuLogicalTypeNative type);
+            try { return NativeMethods.kuzu_data_type_get_id(ref type); }
+            finally { NativeMethods.kuzu_data_type_destroy(ref type); }
+        }
+
+        /// <summary>
+        /// Gets the escaped text form of a BLOB value for <see cref="BlobCodec"/> (free with <c>kuzu_destroy_string</c>),
+        /// or <see cref="IntPtr.Zero"/> when the value is not a BLOB.
+        /// </summary>
+        public static IntPtr GetBlobText(IntPtr value)
+        {
+            if (GetTypeId(value) != KuzuDataTypeId.Blob) return IntPtr.Zero;
+            return NativeMethods.kuzu_value_to_string(value);
+        }
+
+        /// <summary>
+        /// Returns the value as its natural CLR type (see <see cref="KuzuDataReader.GetFieldType"/>), null for NULL, and
+        /// the engine's text form for nested and graph types.
+        /// </summary>
+        public static object Decode(IntPtr value, KuzuDataTypeId type)
+        {
+            if (NativeMethods.kuzu_value_is_null(value)) return null;
+            KuzuState state;
+            object result;
+            switch (type)
+            {
+                case KuzuDataTypeId.Bool: state = NativeMethods.kuzu_value_get_bool(value, out var b); result = b; break;
+                case KuzuDataTypeId.Int8: state = NativeMethods.kuzu_value_get_int8(value, out var i8); result = i8; break;
+                case KuzuDataTypeId.Int16: state = NativeMethods.kuzu_value_get_int16(value, out var i16); result = i16; break;
+                case KuzuDataTypeId.Int32: state = NativeMethods.kuzu_value_get_int32(value, out var i32); result = i32; break;
+                case KuzuDataTypeId.Int64:
+                case KuzuDataTypeId.Serial: state = NativeMethods.kuzu_value_get_int64(value, out var i64); result = i64; break;
+                case KuzuDataTypeId.UInt8: state = NativeMethods.kuzu_value_get_uint8(value, out var u8); result = u8; break;
+                case KuzuDataTypeId.UInt16: state = NativeMethods.kuzu_value_get_uint16(value, out var u16); result = u16; break;
+                case KuzuDataTypeId.UInt32: state = NativeMethods.kuzu_value_get_uint32(value, out var u32); result = u32; break;
+                case KuzuDataTypeId.UInt64: state = NativeMethods.kuzu_value_get_uint64(value, out var u64); result = u64; break;
+                case KuzuDataTypeId.Int128: state = NativeMethods.kuzu_value_get_int128(value, out var i128); result = Int128Utilities.ToBigInteger(i128); break;
+                case KuzuDataTypeId.Float: state = NativeMethods.kuzu_value_get_float(value, out var f); result = f; break;
+                case KuzuDataTypeId.Double: state = NativeMethods.kuzu_value_get_double(value, out var d); result = d; break;
+                case KuzuDataTypeId.Date: state = NativeMethods.kuzu_value_get_date(value, out var date); result = DateTimeUtilities.KuzuDateToDateTime(date); break;
+                case KuzuDataTypeId.Timestamp: state = NativeMethods.kuzu_value_get_timestamp(value, out var ts); result = DateTimeUtilities.NativeTimestampToDateTime(ts); break;
+                case KuzuDataTypeId.TimestampNs: state = NativeMethods.kuzu_value_get_timestamp_ns(value, out var ns); result = DateTimeUtilities.UnixMicrosecondsToDateTime(ns.Value / 1000); break;
+                case KuzuDataTypeId.TimestampMs: state = NativeMethods.kuzu_value_get_timestamp_ms(value, out var ms); result = DateTimeUtilities.UnixMicrosecondsToDateTime(ms.Value * 1000); break;
+                case KuzuDataTypeId.TimestampSec: state = NativeMethods.kuzu_value_get_timestamp_sec(value, out var sec); result = DateTimeUtilities.UnixMicrosecondsToDateTime(sec.Value * 1_000_000); break;
+                case KuzuDataTypeId.TimestampTz: state = NativeMethods.kuzu_value_get_timestamp_tz(value, out var tz); result = DateTimeUtilities.UnixMicrosecondsToDateTime(tz.Value); break;
+                case KuzuDataTypeId.Interval: state = NativeMethods.kuzu_value_get_interval(value, out var iv); result = DateTimeUtilities.NativeIntervalToTimeSpan(iv); break;
+                case KuzuDataTypeId.InternalId: state = NativeMethods.kuzu_value_get_internal_id(value, out var id); result = new InternalId(id); break;
+                case KuzuDataTypeId.String: state = NativeMethods.kuzu_value_get_string(value, out var str); result = TakeString(state, str); break;
+                case KuzuDataTypeId.Decimal: state = NativeMethods.kuzu_value_get_decimal_as_string(value, out var dec); result = TakeString(state, dec); break;
+                case KuzuDataTypeId.Uuid: state = NativeMethods.kuzu_value_get_uuid(value, out var uuid); result = TakeString(state, uuid); break;
+                case KuzuDataTypeId.Blob: state = KuzuState.Success; result = TakeBlob(NativeMethods.kuzu_value_to_string(value)); break;
+                default: return NativeUtil.PtrToStringAndDestroy(NativeMethods.kuzu_value_to_string(value), NativeMethods.kuzu_destroy_string);
+            }
+            if (state != KuzuState.Success) throw new KuzuException($"Failed to decode {type} value");
+            return result;
+        }
+
+        private static string TakeString(KuzuState state, IntPtr str)
+        {
+            if (state != KuzuState.Success || str == IntPtr.Zero) return string.Empty;
+            try { return NativeUtil.PtrToStringUtf8(str) ?? string.Empty; }
+            finally { NativeMethods.kuzu_destroy_string(str); }
+        }
+
+        private static byte[] TakeBlob(IntPtr text)
+        {
+            if (text == IntPtr.Zero) return Array.Empty<byte>();
+            try { return BlobCodec.Decode(NativeUtil.Utf8Span(text)); }
+            finally { NativeMethods.kuzu_destroy_string(text); }
+        }
+    }
+}
@@ -0,0 +1,245 @@
+using System;
+using System.Collections.Generic;
+using System.Threading;
+
+namespace KuzuDot
+{
+    public sealed class NodeCacheOptions
+    {
+        /// <summary>Maximum number of cached nodes, split evenly across shards.</summary>
+        public int Capacity { get; set; } = 10_000;
+        /// <summary>Number of independently locked LRU shards; more shards reduce contention between threads.</summary>
+        public int ShardCount { get; set; } = 16;
+
+        internal void Validate()
+        {
+            if (Capacity <= 0) throw new ArgumentOutOfRangeException(nameof(Capacity), "Capacity must be positive");
+            if (ShardCount <= 0) throw new ArgumentOutOfRangeException(nameof(ShardCount), "ShardCount must be positive");
+        }
+
+        public override string ToString() => $"NodeCacheOptions(Capacity={Capacity}, Shards={ShardCount})";
+    }
+
+    /// <summary>
+    /// Bounded, sharded LRU cache of materialized <see cref="KuzuNode"/>s keyed by <see cref="InternalId"/>, enabled with
+    /// <see cref="Connection.EnableNodeCache"/>. Misses are loaded through the owning connection with one prepared
+    /// <c>MATCH (n) WHERE id(n) = $id</c> lookup; hits make no native call.
+    /// </summary>
+    /// <remarks>
+    /// Every shard is tagged with the <see cref="Database.WriteGeneration"/> it was filled under and is emptied on first use
+    /// after the generation changes, so any write through this wrapper on the same <see cref="Database"/> (from any
+    /// connection) invalidates the cache. Writes made by other processes are not observed. The cache is thread-safe;
+    /// loads are serialized on the owning connection.
+    /// </remarks>
+    public sealed class NodeCache
+    {
+        private const string LoadQuery = "MATCH (n) WHERE id(n) = $id RETURN n;";
+
+        private readonly Connection _connection;
+        private readonly Database _database;
+        private readonly Shard[] _shards;
+        private readonly object _loadLock = new object();
+        private PreparedStatement _load;
+        private bool _released;
+        private long _hits;
+        private long _misses;
+        private long _evictions;
+        private long _invalidations;
+
+        internal NodeCache(Connection connection, NodeCacheOptions options)
+        {
+            _connection = connection;
+            _database = connection.Database;
+            Capacity = options.Capacity;
+            var shardCount = Math.Min(options.ShardCount, options.Capacity);
+            var perShard = (options.Capacity + shardCount - 1) / shardCount;
+            _shards = new Shard[shardCount];
+            for (int i = 0; i < shardCount; i++) _shards[i] = new Shard(perShard);
+        }
+
+        public int Capacity { get; }
+        public int ShardCount => _shards.Length;
+        public int Count
+        {
+            get
+            {
+                int count = 0;
+                foreach (var shard in _shards) lock (shard) count += shard.Map.Count;
+                return count;
+            }
+        }
+        public long Hits => Interlocked.Read(ref _hits);
+        public long Misses => Interlocked.Read(ref _misses);
+        public long Evictions => Interlocked.Read(ref _evictions);
+        /// <summary>Entries dropped because the database's write generation moved on.</summary>
+        public long Invalidations => Interlocked.Read(ref _invalidations);
+
+        /// <summary>Gets a cached node without touching the database.</summary>
+        public bool TryGet(InternalId id, out KuzuNode node)
+        {
+            var shard = ShardFor(id);
+            lock (shard)
+            {
+                // Read under the shard lock, as Add does, so a stale read cannot move the shard's generation backwards.
+                Sync(shard, _database.WriteGeneration);
+                if (shard.Map.TryGetValue(id, out var entry))
+                {
+                    if (entry != shard.Lru.First)
+                    {
+                        shard.Lru.Remove(entry);
+                        shard.Lru.AddFirst(entry);
+                    }
+                    Interlocked.Increment(ref _hits);
+                    node = entry.Value;
+                    return true;
+                }
+            }
+            Interlocked.Increment(ref _misses);
+            node = default;
+            return false;
+        }
+
+        /// <summary>Gets a node from the cache, loading and caching it on a miss.</summary>
+        /// <exception cref="KeyNotFoundException">No node has id <paramref name="id"/>.</exception>
+        /// <exception cref="ObjectDisposedException">The cache was disabled or its connection disposed.</exception>
+        public KuzuNode GetOrLoad(InternalId id)
+        {
+            if (TryGetOrLoad(id, out var node)) return node;
+            throw new KeyNotFoundException($"No node with {id}");
+        }
+
+        /// <summary>Gets a node from the cache, loading and caching it on a miss; false when no node has <paramref name="id"/>.</summary>
+        public bool TryGetOrLoad(InternalId id, out KuzuNode node)
+        {
+            if (TryGet(id, out node)) return true;
+            // Read the generation before loading: if a write lands during the load, the result is not cached.
+            var generation = _database.WriteGeneration;
+            if (!Load(id, out node)) return false;
+            Add(id, node, generation);
+            return true;
+        }
+
+        /// <summary>Drops one node from the cache.</summary>
+        public bool Remove(InternalId id)
+        {
+            var shard = ShardFor(id);
+            lock (shard)
+            {
+                if (!shard.Map.TryGetValue(id, out var entry)) return false;
+                shard.Lru.Remove(entry);
+                shard.Map.Remove(id);
+                return true;
+            }
+        }
+
+        /// <summary>Drops every cached node. Counters are kept.</summary>
+        public void Clear()
+        {
+            foreach (var shard in _shards)
+            {
+                lock (shard)
+                {
+                    shard.Map.Clear();
+                    shard.Lru.Clear();
+                }
+            }
+        }
+
+        /// <summary>Clears the cache and releases its prepared lookup statement; later loads throw <see cref="ObjectDisposedException"/>.</summary>
+        internal void Release()
+        {
+            Clear();
+            lock (_loadLock)
+            {
+                _released = true;
+                _load?.Dispose();
+                _load = null;
+            }
+        }
+
+        private bool Load(InternalId id, out KuzuNode node)
+        {
+            lock (_loadLock)
+            {
+                // Without this check a load racing Release would re-prepare the lookup after it was disposed and leak it.
+                if (_released) throw new ObjectDisposedException(nameof(NodeCache), "The node cache has been disabled or its connection disposed");
+                if (_load == null)
+                {
+                    var statement = _connection.PrepareUncached(LoadQuery);
+                    if (!statement.IsSuccess)
+                    {
+                        var message = statement.ErrorMessage;
+                        statement.Dispose();
+                        throw new KuzuException($"Failed to prepare node lookup: {message}");
+                    }
+                    _load = statement;
+                }
+                using (var value = KuzuValue.CreateInternalId(id))
+                {
+                    _load.BindValue("id", value);
+                }
+                using (var result = _load.Execute())
+                {
+                    var reader = result.GetReader();
+                    node = reader.Read() ? reader.ReadNode(0) : default;
+                    return reader.HasRow;
+                }
+            }
+        }
+
+        private void Add(InternalId id, KuzuNode node, long generation)
+        {
+            var shard = ShardFor(id);
+            lock (shard)
+            {
+                var current = _database.WriteGeneration;
+                Sync(shard, current);
+                if (generation != current) return;
+                if (shard.Map.TryGetValue(id, out var existing))
+                {
+                    existing.Value = node;
+                    return;
+                }
+                if (shard.Map.Count >= shard.Capacity)
+                {
+                    var last = shard.Lru.Last;
+                    shard.Lru.RemoveLast();
+                    shard.Map.Remove(last.Value.Id);
+                    Interlocked.Increment(ref _evictions);
+                }
+                shard.Map.Add(id, shard.Lru.AddFirst(node));
+            }
+        }
+
+        /// <summary>Empties <paramref name="shard"/> if it was filled under an older write generation. Call under the shard lock.</summary>
+        private void Sync(Shard shard, long generation)
+        {
+            if (shard.Generation == generation) return;
+            if (shard.Map.Count != 0)
+            {
+                Interlocked.Add(ref _invalidations, shard.Map.Count);
+                shard.Map.Clear();
+                shard.Lru.Clear();
+            }
+            shard.Generation = generation;
+        }
+
+        private Shard ShardFor(InternalId id) => _shards[(int)((uint)id.GetHashCode() * 2654435769u % (uint)_shards.Length)];
+
+        public override string ToString() => $"NodeCache(Count={Count}/{Capacity}, Shards={ShardCount}, Hits={Hits}, Misses={Misses}, Invalidations={Invalidations})";
+
+        private sealed class Shard
+        {
+            internal readonly Dictionary<InternalId, LinkedListNode<KuzuNode>> Map;
+            internal readonly LinkedList<KuzuNode> Lru = new LinkedList<KuzuNode>(); // most recently used first
+            internal readonly int Capacity;
+            internal long Generation;
+
+            internal Shard(int capacity)
+            {
+                Capacity = capacity;
+                Map = new Dictionary<InternalId, LinkedListNode<KuzuNode>>(Math.Min(capacity, 1024));
+            }
+        }
+    }
+}
@@ -0,0 +1,324 @@
+using System;
+using System.Collections.Concurrent;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Threading;
+using System.Threading.Tasks;
+using KuzuDot.Utils;
+
+namespace KuzuDot
+{
+    public sealed class ParallelIngestOptions
+    {
+        /// <summary>Number of connections (and worker threads) rows are sharded across.</summary>
+        public int DegreeOfParallelism { get; set; } = Environment.ProcessorCount;
+        /// <summary>Rows executed per write transaction.</summary>
+        public int BatchSize { get; set; } = 1000;
+        /// <summary>Filled batches that may wait per worker before the producer blocks.</summary>
+        public int MaxPendingBatchesPerWorker { get; set; } = 2;
+        /// <summary>Times a batch is retried after a transient failure before the ingest fails.</summary>
+        public int MaxRetries { get; set; } = 8;
+        /// <summary>
+        /// How long a batch keeps retrying while the engine rejects its transaction because another worker holds the single
+        /// write transaction. These rejections are expected under contention and do not count against <see cref="MaxRetries"/>.
+        /// <see cref="System.Threading.Timeout.InfiniteTimeSpan"/> waits indefinitely.
+        /// </summary>
+        public TimeSpan WriteTransactionTimeout { get; set; } = TimeSpan.FromMinutes(5);
+        /// <summary>Delay before the first retry; doubled (with jitter) on each further attempt.</summary>
+        public TimeSpan RetryDelay { get; set; } = TimeSpan.FromMilliseconds(5);
+        /// <summary>Applied to every worker connection when non-zero; 1 avoids oversubscribing cores across workers.</summary>
+        public ulong MaxNumThreadsForExecution { get; set; } = 1;
+        /// <summary>
+        /// Decides whether a failed batch is retried. Defaults to <see cref="ParallelIngestor.IsWriteConflict"/>.
+        /// </summary>
+        public Func<KuzuException, bool> IsTransient { get; set; }
+
+        internal void Validate()
+        {
+            if (DegreeOfParallelism <= 0) throw new ArgumentOutOfRangeException(nameof(DegreeOfParallelism), "DegreeOfParallelism must be positive");
+            if (BatchSize <= 0) throw new ArgumentOutOfRangeException(nameof(BatchSize), "BatchSize must be positive");
+            if (MaxPendingBatchesPerWorker <= 0) throw new ArgumentOutOfRangeException(nameof(MaxPendingBatchesPerWorker), "MaxPendingBatchesPerWorker must be positive");
+            if (MaxRetries < 0) throw new ArgumentOutOfRangeException(nameof(MaxRetries), "MaxRetries cannot be negative");
+            if (RetryDelay < TimeSpan.Zero) throw new ArgumentOutOfRangeException(nameof(RetryDelay), "RetryDelay cannot be negative");
+            if (WriteTransactionTimeout < TimeSpan.Zero && WriteTransactionTimeout != Timeout.InfiniteTimeSpan)
+                throw new ArgumentOutOfRangeException(nameof(WriteTransactionTimeout), "WriteTransactionTimeout cannot be negative");
+        }
+
+        public override string ToString() => $"ParallelIngestOptions(Workers={DegreeOfParallelism}, BatchSize={BatchSize}, MaxRetries={MaxRetries})";
+    }
+
+    /// <summary>
+    /// Aggregate outcome and throughput of a <see cref="ParallelIngestor"/> run.
+    /// </summary>
+    public sealed class ParallelIngestResult
+    {
+        internal ParallelIngestResult(long rows, long batches, long retries, long writeTransactionWaits, int workers, TimeSpan elapsed)
+        {
+            RowsIngested = rows;
+            Batches = batches;
+            Retries = retries;
+            WriteTransactionWaits = writeTransactionWaits;
+            Workers = workers;
+            Elapsed = elapsed;
+        }
+
+        /// <summary>Rows in committed batches.</summary>
+        public long RowsIngested { get; }
+        /// <summary>Committed write transactions.</summary>
+        public long Batches { get; }
+        /// <summary>Batch attempts rolled back and retried after a transient failure.</summary>
+        public long Retries { get; }
+        /// <summary>Transaction starts rejected, and retried, because another worker held the write transaction.</summary>
+        public long WriteTransactionWaits { get; }
+        public int Workers { get; }
+        /// <summary>Wall-clock time from the first row read to the last commit.</summary>
+        public TimeSpan Elapsed { get; }
+        public double RowsPerSecond => Elapsed > TimeSpan.Zero ? RowsIngested / Elapsed.TotalSeconds : 0;
+
+        public override string ToString() => $"ParallelIngestResult(Rows={RowsIngested}, Batches={Batches}, Retries={Retries}, Waits={WriteTransactionWaits}, Workers={Workers}, Elapsed={Elapsed.TotalMilliseconds:F1}ms, Rows/s={RowsPerSecond:F0})";
+    }
+
+    /// <summary>
+    /// Shards a row stream across several connections to one <see cref="Database"/>, each running a prepared write
+    /// statement (<c>CREATE</c>/<c>MERGE</c>) in explicit transactions of <see cref="ParallelIngestOptions.BatchSize"/>
+    /// rows on its own thread. A batch that fails with a transient error (a write-write conflict by default) is rolled
+    /// back and retried with exponential backoff, so every committed row is applied exactly once.
+    /// </summary>
+    /// <remarks>
+    /// Without a partition key, rows are dealt to workers in whole batches; with one, rows with equal keys always go to
+    /// the same worker, which keeps their relative order and avoids conflicts between workers on the same entity.
+    /// The engine allows one write transaction at a time, so workers overlap row reading, binding and their queues, but
+    /// their transactions are serialized: a worker whose <c>BEGIN TRANSACTION</c> is rejected because another holds the
+    /// write transaction waits and retries for up to <see cref="ParallelIngestOptions.WriteTransactionTimeout"/>. Larger
+    /// batches amortize that hand-off better than more workers.
+    /// The first non-transient failure stops all workers; batches committed before it stay applied and the exception
+    /// reports how many rows that covers.
+    /// </remarks>
+    public sealed class ParallelIngestor
+    {
+        private readonly Database _database;
+        private readonly ParallelIngestOptions _options;
+
+        internal ParallelIngestor(Database database, ParallelIngestOptions options)
+        {
+            options.Validate();
+            _database = database;
+            _options = options;
+        }
+
+        /// <summary>
+        /// Default transient-failure check: write-write conflicts.
+        /// </summary>
+        public static bool IsWriteConflict(KuzuException exception) => MessageContains(exception, "conflict");
+
+        /// <summary>
+        /// True when the engine rejected a transaction because another connection holds the single write transaction.
+        /// The ingestor waits these out under <see cref="ParallelIngestOptions.WriteTransactionTimeout"/> instead of
+        /// treating them as failures.
+        /// </summary>
+        public static bool IsWriteTransactionBusy(KuzuException exception)
+            => MessageContains(exception, "one write transaction") || MessageContains(exception, "new write transaction");
+
+        private static bool MessageContains(Exception exception, string text)
+        {
+            for (Exception e = exception; e != null; e = e.InnerException)
+            {
+                if (e.Message.IndexOf(text, StringComparison.OrdinalIgnoreCase) >= 0) return true;
+            }
+            return false;
+        }
+
+        /// <summary>
+        /// Executes <paramref name="statement"/> once per row, binding its parameters through <paramref name="bind"/>.
+        /// </summary>
+        /// <param name="partitionKey">Optional key; rows with equal keys are executed by the same worker in input order.</param>
+        public ParallelIngestResult Ingest<TRow>(string statement, IEnumerable<TRow> rows, Action<ParameterBinder, TRow> bind, Func<TRow, object> partitionKey = null, CancellationToken cancellationToken = default)
+        {
+            KuzuGuard.NotNullOrEmpty(statement, nameof(statement));
+            KuzuGuard.NotNull(rows, nameof(rows));
+            KuzuGuard.NotNull(bind, nameof(bind));
+            return new Run<TRow>(this, statement, bind, partitionKey).Execute(rows, cancellationToken);
+        }
+
+        /// <summary>
+        /// Executes <paramref name="statement"/> once per row, binding each row's members to the same-named parameters
+        /// (see <see cref="PreparedStatement.BindParameters{TParams}"/>).
+        /// </summary>
+        public ParallelIngestResult Ingest<TRow>(string statement, IEnumerable<TRow> rows, Func<TRow, object> partitionKey = null, CancellationToken cancellationToken = default)
+            => Ingest(statement, rows, (binder, row) => binder.BindParameters(row), partitionKey, cancellationToken);
+
+        private sealed class Run<TRow>
+        {
+            private readonly ParallelIngestor _owner;
+            private readonly string _statement;
+            private readonly Action<ParameterBinder, TRow> _bind;
+            private readonly Func<TRow, object> _partitionKey;
+            private readonly Func<KuzuException, bool> _isTransient;
+            private long _rows;
+            private long _batches;
+            private long _retries;
+            private long _waits;
+            private Exception _failure;
+
+            internal Run(ParallelIngestor owner, string statement, Action<ParameterBinder, TRow> bind, Func<TRow, object> partitionKey)
+            {
+                _owner = owner;
+                _statement = statement;
+                _bind = bind;
+                _partitionKey = partitionKey;
+                _isTransient = owner._options.IsTransient ?? IsWriteConflict;
+            }
+
+            internal ParallelIngestResult Execute(IEnumerable<TRow> rows, CancellationToken cancellationToken)
+            {
+                var options = _owner._options;
+                int workerCount = options.DegreeOfParallelism;
+                var stopwatch = Stopwatch.StartNew();
+                var connections = new List<Connection>(workerCount);
+                var queues = new BlockingCollection<List<TRow>>[workerCount];
+                var workers = new Task[workerCount];
+                using (var stop = CancellationTokenSource.CreateLinkedTokenSource(cancellationToken))
+                {
+                    try
+                    {
+                        for (int i = 0; i < workerCount; i++)
+                        {
+                            var connection = _owner._database.Connect();
+                            connections.Add(connection);
+                            if (options.MaxNumThreadsForExecution != 0) connection.MaxNumThreadsForExecution = options.MaxNumThreadsForExecution;
+                            queues[i] = new BlockingCollection<List<TRow>>(options.MaxPendingBatchesPerWorker);
+                        }
+                        for (int i = 0; i < workerCount; i++)
+                        {
+                            var connection = connections[i];
+                            var queue = queues[i];
+                            workers[i] = Task.Factory.StartNew(() => Work(connection, queue, stop), CancellationToken.None, TaskCreationOptions.LongRunning, TaskScheduler.Default);
+                        }
+                        try { Produce(rows, queues, stop.Token); }
+                        catch (OperationCanceledException) when (Volatile.Read(ref _failure) != null) { }
+                        catch (Exception ex) { Fail(ex, stop); }
+                        finally
+                        {
+                            foreach (var queue in queues) queue?.CompleteAdding();
+                        }
+                        foreach (var worker in workers) worker?.Wait();
+                    }
+                    finally
+                    {
+                        foreach (var queue in queues) queue?.Dispose();
+                        foreach (var connection in connections) connection.Dispose();
+                    }
+                }
+                var failure = Volatile.Read(ref _failure);
+                var committed = Interlocked.Read(ref _rows);
+                if (failure is OperationCanceledException) throw new OperationCanceledException($"Parallel ingest cancelled after {committed} committed rows", failure, cancellationToken);
+                if (failure != null) throw new KuzuException($"Parallel ingest failed after {committed} committed rows: {failure.Message}", failure);
+                return new ParallelIngestResult(committed, Interlocked.Read(ref _batches), Interlocked.Read(ref _retries), Interlocked.Read(ref _waits), workerCount, stopwatch.Elapsed);
+            }
+
+            private void Produce(IEnumerable<TRow> rows, BlockingCollection<List<TRow>>[] queues, CancellationToken token)
+            {
+                int batchSize = _owner._options.BatchSize;
+                var pending = new List<TRow>[queues.Length];
+                int next = 0;
+                foreach (var row in rows)
+                {
+                    token.ThrowIfCancellationRequested();
+                    int shard;
+                    if (_partitionKey == null) shard = next;
+                    else shard = ((_partitionKey(row)?.GetHashCode() ?? 0) & int.MaxValue) % queues.Length;
+                    var batch = pending[shard] ??= new List<TRow>(batchSize);
+                    batch.Add(row);
+                    if (batch.Count < batchSize) continue;
+                    queues[shard].Add(batch, token);
+                    pending[shard] = null;
+                    if (_partitionKey == null) next = (next + 1) % queues.Length;
+                }
+                for (int i = 0; i < pending.Length; i++)
+                {
+                    if (pending[i] != null) queues[i].Add(pending[i], token);
+                }
+            }
+
+            private void Work(Connection connection, BlockingCollection<List<TRow>> queue, CancellationTokenSource stop)
+            {
+                try
+                {
+                    using (var statement = connection.Prepare(_statement))
+                    {
+                        if (!statement.IsSuccess) throw new KuzuException($"Failed to prepare ingest statement: {statement.ErrorMessage}");
+                        using (var binder = new ParameterBinder(statement))
+                        {
+                            foreach (var batch in queue.GetConsumingEnumerable(stop.Token)) Commit(connection, statement, binder, batch, stop.Token);
+                        }
+                    }
+                }
+                catch (Exception ex) { Fail(ex, stop); }
+            }
+
+            private void Commit(Connection connection, PreparedStatement statement, ParameterBinder binder, List<TRow> batch, CancellationToken token)
+            {
+                var options = _owner._options;
+                Stopwatch waiting = null;
+                int attempt = 0, waits = 0;
+                while (true)
+                {
+                    token.ThrowIfCancellationRequested();
+                    try
+                    {
+                        using (var transaction = connection.BeginTransaction())
+                        {
+                            for (int i = 0; i < batch.Count; i++)
+                            {
+                                _bind(binder, batch[i]);
+                                connection.ExecuteDiscardingResult(statement, i);
+                            }
+                            transaction.Commit();
+                        }
+                        Interlocked.Add(ref _rows, batch.Count);
+                        Interlocked.Increment(ref _batches);
+                        return;
+                    }
+                    catch (KuzuException ex) when (IsWriteTransactionBusy(ex))
+                    {
+                        // Another worker holds the write transaction: wait on elapsed time, not the conflict retry budget.
+                        waiting ??= Stopwatch.StartNew();
+                        var timeout = options.WriteTransactionTimeout;
+                        if (timeout != Timeout.InfiniteTimeSpan && waiting.Elapsed >= timeout)
+                            throw new KuzuException($"Gave up after waiting {timeout} for another connection's write transaction to finish", ex);
+                        Interlocked.Increment(ref _waits);
+                        Backoff(Math.Min(waits++, 4), token);
+                    }
+                    catch (KuzuException ex) when (attempt < options.MaxRetries && _isTransient(ex))
+                    {
+                        Interlocked.Increment(ref _retries);
+                        Backoff(attempt++, token);
+                    }
+                }
+            }
+
+            private void Backoff(int attempt, CancellationToken token)
+            {
+                var baseTicks = _owner._options.RetryDelay.Ticks << Math.Min(attempt, 16);
+                var jittered = (long)(baseTicks * (0.5 + ThreadLocalRandom.NextDouble()));
+                if (jittered > 0) token.WaitHandle.WaitOne(TimeSpan.FromTicks(jittered));
+            }
+
+            private void Fail(Exception ex, CancellationTokenSource stop)
+            {
+                // Keep the first real error; cancellations that it caused are not reported.
+                if (ex is OperationCanceledException && Volatile.Read(ref _failure) != null) return;
+                Interlocked.CompareExchange(ref _failure, ex, null);
+                try { stop.Cancel(); } catch (ObjectDisposedException) { }
+            }
+        }
+
+        private static class ThreadLocalRandom
+        {
+            [ThreadStatic] private static Random _random;
+            internal static double NextDouble() => (_random ??= new Random(Guid.NewGuid().GetHashCode())).NextDouble();
+        }
+
+        public override string ToString() => $"ParallelIngestor({_options})";
+    }
+}
@@ -0,0 +1,57 @@
+using System;
+using KuzuDot.Native;
+using KuzuDot.Native.Enums;
+using KuzuDot.Utils;
+
+namespace KuzuDot
+{
+    /// <summary>
+    /// Binds parameters of a <see cref="PreparedStatement"/> during <see cref="PreparedStatement.ExecuteBatch{TRow}"/>.
+    /// Parameter names resolve to the statement-owned native copies (see <see cref="PreparedStatement.GetParameter"/>),
+    /// so no name is marshaled per row. Only valid inside the bind callback of the batch that created it.
+    /// </summary>
+    public sealed class ParameterBinder : IDisposable
+    {
+        private readonly PreparedStatement _statement;
+        private bool _disposed;
+
+        internal ParameterBinder(PreparedStatement statement) { _statement = statement; }
+
+        public void BindBool(string paramName, bool value) => Check(NativeMethods.kuzu_prepared_statement_bind_bool(ref _statement.NativeStruct, Name(paramName), value), paramName);
+        public void BindInt8(string paramName, sbyte value) => Check(NativeMethods.kuzu_prepared_statement_bind_int8(ref _statement.NativeStruct, Name(paramName), value), paramName);
+        public void BindInt16(string paramName, short value) => Check(NativeMethods.kuzu_prepared_statement_bind_int16(ref _statement.NativeStruct, Name(paramName), value), paramName);
+        public void BindInt32(string paramName, int value) => Check(NativeMethods.kuzu_prepared_statement_bind_int32(ref _statement.NativeStruct, Name(paramName), value), paramName);
+        public void BindInt64(string paramName, long value) => Check(NativeMethods.kuzu_prepared_statement_bind_int64(ref _statement.NativeStruct, Name(paramName), value), paramName);
+        public void BindUInt8(string paramName, byte value) => Check(NativeMethods.kuzu_prepared_statement_bind_uint8(ref _statement.NativeStruct, Name(paramName), value), paramName);
+        public void BindUInt16(string paramName, ushort value) => Check(NativeMethods.kuzu_prepared_statement_bind_uint16(ref _statement.NativeStruct, Name(paramName), value), paramName);
+        public void BindUInt32(string paramName, uint value) => Check(NativeMethods.kuzu_prepared_statement_bind_uint32(ref _statement.NativeStruct, Name(paramName), value), paramName);
+        public void BindUInt64(string paramName, ulong value) => Check(NativeMethods.kuzu_prepared_statement_bind_uint64(ref _statement.NativeStruct, Name(paramName), value), paramName);
+        public void BindFloat(string paramName, float value) => Check(NativeMethods.kuzu_prepared_statement_bind_float(ref _statement.NativeStruct, Name(paramName), value), paramName);
+        public void BindDouble(string paramName, double value) => Check(NativeMethods.kuzu_prepared_statement_bind_double(ref _statement.NativeStruct, Name(paramName), value), paramName);
+        public void BindString(string paramName, string value) => Check(NativeMethods.kuzu_prepared_statement_bind_string(ref _statement.NativeStruct, Name(paramName), value ?? string.Empty), paramName);
+        public void BindStringUtf8(string paramName, ReadOnlySpan<byte> utf8Value) { if (_disposed) throw new ObjectDisposedException(nameof(ParameterBinder)); _statement.BindStringUtf8(paramName, utf8Value); }
+        public void BindBlob(string paramName, ReadOnlySpan<byte> data) { if (_disposed) throw new ObjectDisposedException(nameof(ParameterBinder)); _statement.BindBlob(paramName, data); }
+        public void BindDate(string paramName, DateTime value) => Check(NativeMethods.kuzu_prepared_statement_bind_date(ref _statement.NativeStruct, Name(paramName), DateTimeUtilities.DateTimeToKuzuDate(value)), paramName);
+        public void BindTimestamp(string paramName, DateTime value) => Check(NativeMethods.kuzu_prepared_statement_bind_timestamp(ref _statement.NativeStruct, Name(paramName), DateTimeUtilities.DateTimeToNativeTimestamp(value)), paramName);
+        public void BindTimestampWithTimeZone(string paramName, DateTimeOffset value) => Check(NativeMethods.kuzu_prepared_statement_bind_timestamp_tz(ref _statement.NativeStruct, Name(paramName), new KuzuTimestampTz { Value = DateTimeUtilities.DateTimeToUnixMicroseconds(value.UtcDateTime) }), paramName);
+        public void BindInterval(string paramName, TimeSpan value) => Check(NativeMethods.kuzu_prepared_statement_bind_interval(ref _statement.NativeStruct, Name(paramName), DateTimeUtilities.TimeSpanToNativeInterval(value)), paramName);
+        /// <summary>Binds the members of <paramref name="parameters"/> by name; see <see cref="PreparedStatement.BindParameters{TParams}"/>.</summary>
+        public void BindParameters<TParams>(TParams parameters) { if (_disposed) throw new ObjectDisposedException(nameof(ParameterBinder)); _statement.BindParameters(parameters); }
+        public void BindValue(string paramName, KuzuValue value) { KuzuGuard.NotNull(value, nameof(value)); Check(NativeMethods.kuzu_prepared_statement_bind_value(ref _statement.NativeStruct, Name(paramName), value.Handle.Value), paramName); }
+
+        private IntPtr Name(string paramName)
+        {
+            if (_disposed) throw new ObjectDisposedException(nameof(ParameterBinder));
+            KuzuGuard.NotNullOrEmpty(paramName, nameof(paramName));
+            return _statement.ResolveParameterName(paramName);
+        }
+
+        private void Check(KuzuState state, string paramName)
+        {
+            if (state != KuzuState.Success)
+                throw new KuzuException($"Failed to bind parameter '{paramName}': {_statement.ErrorMessage}");
+        }
+
+        public void Dispose() { _disposed = true; }
+    }
+}
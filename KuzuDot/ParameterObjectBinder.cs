@@ -0,0 +1,139 @@
+using System;
+using System.Collections.Concurrent;
+using System.Collections.Generic;
+using System.Linq.Expressions;
+using System.Reflection;
+using System.Threading;
+
+namespace KuzuDot
+{
+    /// <summary>
+    /// Binds the public readable properties and fields of a parameter object (an anonymous object, record or POCO) to
+    /// the same-named statement parameters. A binder is compiled once per type and calls the typed
+    /// <see cref="PreparedStatement"/> bind method for each member's declared type, so member values are not boxed.
+    /// Null references and empty nullables bind NULL; name/value dictionaries are bound entry by entry.
+    /// </summary>
+    internal static class ParameterObjectBinder
+    {
+        private static readonly ConcurrentDictionary<Type, Action<PreparedStatement, object>> ByRuntimeType = new ConcurrentDictionary<Type, Action<PreparedStatement, object>>();
+
+        internal static void Bind<TParams>(PreparedStatement statement, TParams parameters)
+        {
+            // Sealed and value types (including anonymous types and sealed records) are fully known statically;
+            // anything else may be a derived type, so bind by the runtime type.
+            if (typeof(TParams).IsValueType || typeof(TParams).IsSealed) Typed<TParams>.Binder(statement, parameters);
+            else ByRuntimeType.GetOrAdd(parameters.GetType(), CompileUntyped)(statement, parameters);
+        }
+
+        private static class Typed<TParams>
+        {
+            private static Action<PreparedStatement, TParams> _binder;
+
+            // Compiled on first use rather than in a static initializer, so an unsupported member type surfaces as
+            // NotSupportedException to the caller instead of a TypeInitializationException that poisons the type.
+            internal static Action<PreparedStatement, TParams> Binder => Volatile.Read(ref _binder) ?? Interlocked.CompareExchange(ref _binder, Compile<TParams>(), null) ?? _binder;
+        }
+
+        private static Action<PreparedStatement, TParams> Compile<TParams>()
+        {
+            if (IsDictionary(typeof(TParams))) return (s, p) => BindEntries(s, (IEnumerable<KeyValuePair<string, object>>)p);
+            var statement = Expression.Parameter(typeof(PreparedStatement), "statement");
+            var parameters = Expression.Parameter(typeof(TParams), "parameters");
+            return Expression.Lambda<Action<PreparedStatement, TParams>>(BuildBody(statement, parameters), statement, parameters).Compile();
+        }
+
+        private static Action<PreparedStatement, object> CompileUntyped(Type type)
+        {
+            if (IsDictionary(type)) return (s, p) => BindEntries(s, (IEnumerable<KeyValuePair<string, object>>)p);
+            var statement = Expression.Parameter(typeof(PreparedStatement), "statement");
+            var parameters = Expression.Parameter(typeof(object), "parameters");
+            var typed = Expression.Variable(type, "typed");
+            var body = Expression.Block(new[] { typed }, Expression.Assign(typed, Expression.Convert(parameters, type)), BuildBody(statement, typed));
+            return Expression.Lambda<Action<PreparedStatement, object>>(body, statement, parameters).Compile();
+        }
+
+        private static bool IsDictionary(Type type) => typeof(IEnumerable<KeyValuePair<string, object>>).IsAssignableFrom(type);
+
+        private static void BindEntries(PreparedStatement statement, IEnumerable<KeyValuePair<string, object>> entries)
+        {
+            foreach (var pair in entries) statement.BindObject(pair.Key, pair.Value);
+        }
+
+        private static Expression BuildBody(ParameterExpression statement, ParameterExpression parameters)
+        {
+            var body = new List<Expression>();
+            const BindingFlags flags = BindingFlags.Public | BindingFlags.Instance;
+            foreach (var property in parameters.Type.GetProperties(flags))
+            {
+                if (!property.CanRead || property.GetIndexParameters().Length != 0) continue;
+                body.Add(BindMember(statement, property.Name, Expression.Property(parameters, property), parameters.Type));
+            }
+            foreach (var field in parameters.Type.GetFields(flags))
+            {
+                body.Add(BindMember(statement, field.Name, Expression.Field(parameters, field), parameters.Type));
+            }
+            return body.Count == 0 ? (Expression)Expression.Empty() : Expression.Block(body);
+        }
+
+        private static Expression BindMember(ParameterExpression statement, string name, Expression value, Type owner)
+        {
+            var nameConstant = Expression.Constant(name);
+            if (Nullable.GetUnderlyingType(value.Type) != null)
+            {
+                return Expression.IfThenElse(
+                    Expression.Property(value, "HasValue"),
+                    BindValue(statement, nameConstant, Expression.Property(value, "Value"), name, owner),
+                    BindNull(statement, nameConstant));
+            }
+            if (!value.Type.IsValueType)
+            {
+                return Expression.IfThenElse(
+                    Expression.ReferenceEqual(value, Expression.Constant(null, value.Type)),
+                    BindNull(statement, nameConstant),
+                    BindValue(statement, nameConstant, value, name, owner));
+            }
+            return BindValue(statement, nameConstant, value, name, owner);
+        }
+
+        private static Expression BindValue(ParameterExpression statement, Expression name, Expression value, string memberName, Type owner)
+        {
+            var type = value.Type;
+            if (type.IsEnum)
+            {
+                type = Enum.GetUnderlyingType(type);
+                value = Expression.Convert(value, type);
+            }
+            var method = BindMethodFor(type);
+            if (method == null)
+                throw new NotSupportedException($"Member '{memberName}' of {owner} has unsupported parameter type {value.Type}");
+            return Expression.Call(statement, method, name, value);
+        }
+
+        private static Expression BindNull(ParameterExpression statement, Expression name)
+            => Expression.Call(statement, typeof(PreparedStatement).GetMethod(nameof(PreparedStatement.BindNull), BindingFlags.NonPublic | BindingFlags.Instance), name);
+
+        private static MethodInfo BindMethodFor(Type type)
+        {
+            string name;
+            if (type == typeof(bool)) name = nameof(PreparedStatement.BindBool);
+            else if (type == typeof(sbyte)) name = nameof(PreparedStatement.BindInt8);
+            else if (type == typeof(short)) name = nameof(PreparedStatement.BindInt16);
+            else if (type == typeof(int)) name = nameof(PreparedStatement.BindInt32);
+            else if (type == typeof(long)) name = nameof(PreparedStatement.BindInt64);
+            else if (type == typeof(byte)) name = nameof(PreparedStatement.BindUInt8);
+            else if (type == typeof(ushort)) name = nameof(PreparedStatement.BindUInt16);
+            else if (type == typeof(uint)) name = nameof(PreparedStatement.BindUInt32);
+            else if (type == typeof(ulong)) name = nameof(PreparedStatement.BindUInt64);
+            else if (type == typeof(float)) name = nameof(PreparedStatement.BindFloat);
+            else if (type == typeof(double)) name = nameof(PreparedStatement.BindDouble);
+            else if (type == typeof(string)) name = nameof(PreparedStatement.BindString);
+            else if (type == typeof(DateTime)) name = nameof(PreparedStatement.BindTimestamp);
+            else if (type == typeof(DateTimeOffset)) name = nameof(PreparedStatement.BindTimestampWithTimeZone);
+            else if (type == typeof(TimeSpan)) name = nameof(PreparedStatement.BindInterval);
+            else if (type == typeof(KuzuValue)) name = nameof(PreparedStatement.BindValue);
+            else if (type == typeof(byte[])) return typeof(PreparedStatement).GetMethod(nameof(PreparedStatement.BindBlobArray), BindingFlags.NonPublic | BindingFlags.Instance);
+            else return null;
+            return typeof(PreparedStatement).GetMethod(name, new[] { typeof(string), type });
+        }
+    }
+}
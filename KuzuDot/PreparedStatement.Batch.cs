@@ -0,0 +1,61 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using KuzuDot.Utils;
+
+namespace KuzuDot
+{
+    public partial class PreparedStatement
+    {
+        /// <summary>
+        /// Executes the statement once per row, binding parameters through <paramref name="bind"/>.
+        /// Results are not materialized as <see cref="QueryResult"/>s; only their tuple counts are aggregated,
+        /// which makes this suited to write-only statements such as parameterized <c>CREATE</c>.
+        /// Each execution commits on its own unless an explicit transaction is active (see
+        /// <see cref="Connection.BeginTransaction"/>); on failure the exception names the failing row and earlier rows stay applied.
+        /// </summary>
+        public BatchExecutionResult ExecuteBatch<TRow>(IEnumerable<TRow> rows, Action<ParameterBinder, TRow> bind)
+        {
+            ThrowIfDisposed();
+            KuzuGuard.NotNull(rows, nameof(rows));
+            KuzuGuard.NotNull(bind, nameof(bind));
+            if (!IsSuccess) throw new KuzuException($"Cannot execute a statement that failed to prepare: {GetErrorMessageSafe()}");
+            var stopwatch = Stopwatch.StartNew();
+            long executions = 0;
+            ulong tuples = 0;
+            using (var binder = new ParameterBinder(this))
+            {
+                foreach (var row in rows)
+                {
+                    bind(binder, row);
+                    tuples += _connection.ExecuteDiscardingResult(this, executions);
+                    executions++;
+                }
+            }
+            return new BatchExecutionResult(executions, tuples, stopwatch.Elapsed);
+        }
+
+        /// <summary>
+        /// Like <see cref="ExecuteBatch{TRow}(IEnumerable{TRow}, Action{ParameterBinder, TRow})"/>, but commits once per
+        /// <paramref name="rowsPerTransaction"/> rows instead of once per row. On failure the current group is rolled
+        /// back and earlier groups stay committed.
+        /// </summary>
+        /// <exception cref="InvalidOperationException">A transaction is already active on the connection.</exception>
+        public BatchExecutionResult ExecuteBatch<TRow>(IEnumerable<TRow> rows, Action<ParameterBinder, TRow> bind, int rowsPerTransaction)
+        {
+            ThrowIfDisposed();
+            KuzuGuard.NotNull(rows, nameof(rows));
+            KuzuGuard.NotNull(bind, nameof(bind));
+            if (rowsPerTransaction <= 0) throw new ArgumentOutOfRangeException(nameof(rowsPerTransaction), "rowsPerTransaction must be positive");
+            if (!IsSuccess) throw new KuzuException($"Cannot execute a statement that failed to prepare: {GetErrorMessageSafe()}");
+            using (var binder = new ParameterBinder(this))
+            {
+                return _connection.RunInTransactions(rows, rowsPerTransaction, (row, index) =>
+                {
+                    bind(binder, row);
+                    return _connection.ExecuteDiscardingResult(this, index);
+                });
+            }
+        }
+    }
+}
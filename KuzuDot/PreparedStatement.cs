@@ -1,5 +1,9 @@
 using System;
+using System.Collections.Generic;
 using System.Runtime.InteropServices;
+using System.Text;
+using System.Threading;
+using System.Threading.Tasks;
 using KuzuDot.Native;
 using KuzuDot.Native.Enums;
 using KuzuDot.Utils;
@@ -11,6 +15,7 @@ namespace KuzuDot
         private sealed class PreparedStatementSafeHandle : SafeHandle
         {
             internal KuzuPreparedStatement NativeStruct;
+            internal readonly Dictionary<string, IntPtr> ParameterNames = new Dictionary<string, IntPtr>(StringComparer.Ordinal); // UTF-8, null-terminated
             internal PreparedStatementSafeHandle(KuzuPreparedStatement nativeStruct) : base(IntPtr.Zero, true)
             {
                 NativeStruct = nativeStruct; // keeps both PreparedStatement & BoundValues
@@ -28,6 +33,8 @@ namespace KuzuDot
                         NativeStruct.BoundValues = IntPtr.Zero;
                         handle = IntPtr.Zero;
                     }
+                    foreach (var name in ParameterNames.Values) Marshal.FreeHGlobal(name);
+                    ParameterNames.Clear();
                     return true;
                 }
                 catch { return false; }
@@ -37,14 +44,46 @@ namespace KuzuDot
         private readonly PreparedStatementSafeHandle _handle;
         private readonly Connection _connection;
 
-        internal PreparedStatement(KuzuPreparedStatement nativeHandle, Connection connection)
+        internal PreparedStatement(KuzuPreparedStatement nativeHandle, Connection connection, string query)
         {
             _connection = connection ?? throw new ArgumentNullException(nameof(connection));
             _handle = new PreparedStatementSafeHandle(nativeHandle);
+            Query = query;
+            MayWrite = StatementClassifier.MayWrite(query);
         }
 
+        internal string Query { get; } // cache key; null when prepared from UTF-8 bytes outside the cache
+        internal bool MayWrite { get; set; } // executing it bumps Database.WriteGeneration
+        internal PreparedStatementCache Cache { get; set; } // owning cache; null once evicted or when never cached
+        internal bool IsLeased { get; set; } // handed out by Cache and not yet disposed; guarded by the cache's lock
+
         internal IntPtr NativePtr => _handle.DangerousGetHandle();
         internal ref KuzuPreparedStatement NativeStruct => ref _handle.NativeStruct;
+        internal ref KuzuPreparedStatement CheckedNativeStruct { get { ThrowIfDisposed(); return ref _handle.NativeStruct; } }
+
+        /// <summary>
+        /// Returns a handle to the parameter <paramref name="paramName"/>. The handle holds a native copy of the name that
+        /// lives as long as this statement, so binding through it performs no string marshaling or allocation.
+        /// </summary>
+        public BoundParameter GetParameter(string paramName)
+        {
+            KuzuGuard.NotNullOrEmpty(paramName, nameof(paramName));
+            return new BoundParameter(this, paramName, ResolveParameterName(paramName));
+        }
+
+        /// <summary>Returns the statement-owned native copy of <paramref name="paramName"/>, creating it on first use.</summary>
+        internal IntPtr ResolveParameterName(string paramName)
+        {
+            var names = _handle.ParameterNames;
+            lock (names)
+            {
+                ThrowIfDisposed();
+                if (names.TryGetValue(paramName, out var ptr)) return ptr;
+                ptr = NativeUtil.StringToHGlobalUtf8(paramName);
+                names.Add(paramName, ptr);
+                return ptr;
+            }
+        }
 
         public bool IsSuccess
         {
@@ -71,49 +110,92 @@ namespace KuzuDot
         }
 
         // Primitive numeric/bool/string
-        public void BindBool(string paramName, bool value) => Bind(paramName, value, NativeMethods.kuzu_prepared_statement_bind_bool);
-        public void BindInt8(string paramName, sbyte value) => Bind(paramName, value, NativeMethods.kuzu_prepared_statement_bind_int8);
-        public void BindInt16(string paramName, short value) => Bind(paramName, value, NativeMethods.kuzu_prepared_statement_bind_int16);
-        public void BindInt32(string paramName, int value) => Bind(paramName, value, NativeMethods.kuzu_prepared_statement_bind_int32);
-        public void BindInt64(string paramName, long value) => Bind(paramName, value, NativeMethods.kuzu_prepared_statement_bind_int64);
-        public void BindUInt8(string paramName, byte value) => Bind(paramName, value, NativeMethods.kuzu_prepared_statement_bind_uint8);
-        public void BindUInt16(string paramName, ushort value) => Bind(paramName, value, NativeMethods.kuzu_prepared_statement_bind_uint16);
-        public void BindUInt32(string paramName, uint value) => Bind(paramName, value, NativeMethods.kuzu_prepared_statement_bind_uint32);
-        public void BindUInt64(string paramName, ulong value) => Bind(paramName, value, NativeMethods.kuzu_prepared_statement_bind_uint64);
-        public void BindFloat(string paramName, float value) => Bind(paramName, value, NativeMethods.kuzu_prepared_statement_bind_float);
-        public void BindDouble(string paramName, double value) => Bind(paramName, value, NativeMethods.kuzu_prepared_statement_bind_double);
+        public void BindBool(string paramName, bool value) => CheckBind(NativeMethods.kuzu_prepared_statement_bind_bool(ref _handle.NativeStruct, BindName(paramName), value), paramName);
+        public void BindInt8(string paramName, sbyte value) => CheckBind(NativeMethods.kuzu_prepared_statement_bind_int8(ref _handle.NativeStruct, BindName(paramName), value), paramName);
+        public void BindInt16(string paramName, short value) => CheckBind(NativeMethods.kuzu_prepared_statement_bind_int16(ref _handle.NativeStruct, BindName(paramName), value), paramName);
+        public void BindInt32(string paramName, int value) => CheckBind(NativeMethods.kuzu_prepared_statement_bind_int32(ref _handle.NativeStruct, BindName(paramName), value), paramName);
+        public void BindInt64(string paramName, long value) => CheckBind(NativeMethods.kuzu_prepared_statement_bind_int64(ref _handle.NativeStruct, BindName(paramName), value), paramName);
+        public void BindUInt8(string paramName, byte value) => CheckBind(NativeMethods.kuzu_prepared_statement_bind_uint8(ref _handle.NativeStruct, BindName(paramName), value), paramName);
+        public void BindUInt16(string paramName, ushort value) => CheckBind(NativeMethods.kuzu_prepared_statement_bind_uint16(ref _handle.NativeStruct, BindName(paramName), value), paramName);
+        public void BindUInt32(string paramName, uint value) => CheckBind(NativeMethods.kuzu_prepared_statement_bind_uint32(ref _handle.NativeStruct, BindName(paramName), value), paramName);
+        public void BindUInt64(string paramName, ulong value) => CheckBind(NativeMethods.kuzu_prepared_statement_bind_uint64(ref _handle.NativeStruct, BindName(paramName), value), paramName);
+        public void BindFloat(string paramName, float value) => CheckBind(NativeMethods.kuzu_prepared_statement_bind_float(ref _handle.NativeStruct, BindName(paramName), value), paramName);
+        public void BindDouble(string paramName, double value) => CheckBind(NativeMethods.kuzu_prepared_statement_bind_double(ref _handle.NativeStruct, BindName(paramName), value), paramName);
         public void BindString(string paramName, string value)
         {
             ThrowIfDisposed();
             KuzuGuard.NotNullOrEmpty(paramName, nameof(paramName));
             ValidateHandle();
-            var result = NativeMethods.kuzu_prepared_statement_bind_string(ref _handle.NativeStruct, paramName, value ?? string.Empty);
+            var result = NativeMethods.kuzu_prepared_statement_bind_string(ref _handle.NativeStruct, ResolveParameterName(paramName), value ?? string.Empty);
             if (result != KuzuState.Success)
                 throw new KuzuException($"Failed to bind string parameter '{paramName}': {GetErrorMessageSafe()}");
         }
 
+        /// <summary>
+        /// Binds a string parameter from already-encoded UTF-8 bytes, skipping UTF-16 transcoding. The bytes are passed
+        /// through as-is when they end in a NUL terminator; otherwise they are copied once into a terminated buffer.
+        /// </summary>
+        public unsafe void BindStringUtf8(string paramName, ReadOnlySpan<byte> utf8Value)
+        {
+            ThrowIfDisposed();
+            KuzuGuard.NotNullOrEmpty(paramName, nameof(paramName));
+            ValidateHandle();
+            var name = ResolveParameterName(paramName);
+            var terminated = NativeUtil.NullTerminate(utf8Value, stackalloc byte[256], out var rented);
+            try
+            {
+                KuzuState result;
+                fixed (byte* value = terminated) result = NativeMethods.kuzu_prepared_statement_bind_string(ref _handle.NativeStruct, name, (IntPtr)value);
+                if (result != KuzuState.Success)
+                    throw new KuzuException($"Failed to bind string parameter '{paramName}': {GetErrorMessageSafe()}");
+            }
+            finally { NativeUtil.Return(rented); }
+        }
+
+        /// <summary>
+        /// Binds binary data in the engine's escaped BLOB text form (<c>\xHH</c> for non-printable bytes), encoded straight
+        /// into a pooled UTF-8 buffer. The parameter is STRING-typed (the C API cannot create BLOB values), so convert it
+        /// where a BLOB is required: <c>CREATE (:File {data: BLOB($data)})</c> stores the original bytes.
+        /// </summary>
+        public unsafe void BindBlob(string paramName, ReadOnlySpan<byte> data)
+        {
+            ThrowIfDisposed();
+            KuzuGuard.NotNullOrEmpty(paramName, nameof(paramName));
+            ValidateHandle();
+            var name = ResolveParameterName(paramName);
+            var text = BlobCodec.EncodeNullTerminated(data, stackalloc byte[256], out var rented);
+            try
+            {
+                KuzuState result;
+                fixed (byte* value = text) result = NativeMethods.kuzu_prepared_statement_bind_string(ref _handle.NativeStruct, name, (IntPtr)value);
+                if (result != KuzuState.Success)
+                    throw new KuzuException($"Failed to bind blob parameter '{paramName}': {GetErrorMessageSafe()}");
+            }
+            finally { NativeUtil.Return(rented); }
+        }
+
         // Date
-        public void BindDate(string paramName, DateTime value) => Bind(paramName, DateTimeUtilities.DateTimeToKuzuDate(value), NativeMethods.kuzu_prepared_statement_bind_date);
+        public void BindDate(string paramName, DateTime value) => CheckBind(NativeMethods.kuzu_prepared_statement_bind_date(ref _handle.NativeStruct, BindName(paramName), DateTimeUtilities.DateTimeToKuzuDate(value)), paramName);
 
         // Timestamp (microsecond precision)
         public void BindTimestamp(string paramName, DateTime value)
-            => Bind(paramName, DateTimeUtilities.DateTimeToNativeTimestamp(value), NativeMethods.kuzu_prepared_statement_bind_timestamp);
+            => CheckBind(NativeMethods.kuzu_prepared_statement_bind_timestamp(ref _handle.NativeStruct, BindName(paramName), DateTimeUtilities.DateTimeToNativeTimestamp(value)), paramName);
         public void BindTimestampMicros(string paramName, long unixMicros)
-            => Bind(paramName, new KuzuTimestamp { Value = unixMicros }, NativeMethods.kuzu_prepared_statement_bind_timestamp);
+            => CheckBind(NativeMethods.kuzu_prepared_statement_bind_timestamp(ref _handle.NativeStruct, BindName(paramName), new KuzuTimestamp { Value = unixMicros }), paramName);
 
         // Additional precisions (exposed as long based overloads for clarity)
         public void BindTimestampNanoseconds(string paramName, long unixNanos)
-            => Bind(paramName, new KuzuTimestampNs { Value = unixNanos }, NativeMethods.kuzu_prepared_statement_bind_timestamp_ns);
+            => CheckBind(NativeMethods.kuzu_prepared_statement_bind_timestamp_ns(ref _handle.NativeStruct, BindName(paramName), new KuzuTimestampNs { Value = unixNanos }), paramName);
         public void BindTimestampMilliseconds(string paramName, long unixMillis)
-            => Bind(paramName, new KuzuTimestampMs { Value = unixMillis }, NativeMethods.kuzu_prepared_statement_bind_timestamp_ms);
+            => CheckBind(NativeMethods.kuzu_prepared_statement_bind_timestamp_ms(ref _handle.NativeStruct, BindName(paramName), new KuzuTimestampMs { Value = unixMillis }), paramName);
         public void BindTimestampSeconds(string paramName, long unixSeconds)
-            => Bind(paramName, new KuzuTimestampSec { Value = unixSeconds }, NativeMethods.kuzu_prepared_statement_bind_timestamp_sec);
+            => CheckBind(NativeMethods.kuzu_prepared_statement_bind_timestamp_sec(ref _handle.NativeStruct, BindName(paramName), new KuzuTimestampSec { Value = unixSeconds }), paramName);
         public void BindTimestampWithTimeZone(string paramName, DateTimeOffset dto)
-            => Bind(paramName, new KuzuTimestampTz { Value = DateTimeUtilities.DateTimeToUnixMicroseconds(dto.UtcDateTime) }, NativeMethods.kuzu_prepared_statement_bind_timestamp_tz);
+            => CheckBind(NativeMethods.kuzu_prepared_statement_bind_timestamp_tz(ref _handle.NativeStruct, BindName(paramName), new KuzuTimestampTz { Value = DateTimeUtilities.DateTimeToUnixMicroseconds(dto.UtcDateTime) }), paramName);
 
         // Interval
         public void BindInterval(string paramName, TimeSpan value)
-            => Bind(paramName, DateTimeUtilities.TimeSpanToNativeInterval(value), NativeMethods.kuzu_prepared_statement_bind_interval);
+            => CheckBind(NativeMethods.kuzu_prepared_statement_bind_interval(ref _handle.NativeStruct, BindName(paramName), DateTimeUtilities.TimeSpanToNativeInterval(value)), paramName);
 
         // Generic value
         public void BindValue(string paramName, KuzuValue value)
@@ -122,7 +204,7 @@ namespace KuzuDot
             KuzuGuard.NotNullOrEmpty(paramName, nameof(paramName));
             KuzuGuard.NotNull(value, nameof(value));
             ValidateHandle();
-            var result = NativeMethods.kuzu_prepared_statement_bind_value(ref _handle.NativeStruct, paramName, value.Handle.Value);
+            var result = NativeMethods.kuzu_prepared_statement_bind_value(ref _handle.NativeStruct, ResolveParameterName(paramName), value.Handle.Value);
             if (result != KuzuState.Success)
                 throw new KuzuException($"Failed to bind value parameter '{paramName}': {GetErrorMessageSafe()}");
         }
@@ -137,25 +219,96 @@ namespace KuzuDot
         public void Bind(string p, DateTime v) => BindTimestamp(p, v); public void Bind(string p, TimeSpan v) => BindInterval(p, v);
         public void Bind(string p, KuzuValue v) => BindValue(p, v);
 
+
+        /// <summary>
+        /// Binds every public readable property and field of <paramref name="parameters"/> (an anonymous object, record or
+        /// POCO) to the parameter of the same name. The binding code is compiled once per parameter type and
+        /// calls the typed bind method for each member, so value types are not boxed. Null members bind NULL.
+        /// </summary>
+        /// <exception cref="NotSupportedException">A member has a type with no corresponding bind method.</exception>
+        public void BindParameters<TParams>(TParams parameters)
+        {
+            ThrowIfDisposed();
+            KuzuGuard.NotNull(parameters, nameof(parameters));
+            ParameterObjectBinder.Bind(this, parameters);
+        }
+
+        internal void BindNull(string paramName)
+        {
+            using (var value = KuzuValue.CreateNull()) BindValue(paramName, value);
+        }
+
+        internal void BindBlobArray(string paramName, byte[] data) => BindBlob(paramName, data);
+
+        /// <summary>Binds a boxed CLR value through the matching typed overload (null binds a NULL value).</summary>
+        internal void BindObject(string paramName, object value)
+        {
+            switch (value)
+            {
+                case null: BindNull(paramName); break;
+                case bool v: BindBool(paramName, v); break;
+                case sbyte v: BindInt8(paramName, v); break;
+                case short v: BindInt16(paramName, v); break;
+                case int v: BindInt32(paramName, v); break;
+                case long v: BindInt64(paramName, v); break;
+                case byte v: BindUInt8(paramName, v); break;
+                case ushort v: BindUInt16(paramName, v); break;
+                case uint v: BindUInt32(paramName, v); break;
+                case ulong v: BindUInt64(paramName, v); break;
+                case float v: BindFloat(paramName, v); break;
+                case double v: BindDouble(paramName, v); break;
+                case string v: BindString(paramName, v); break;
+                case DateTime v: BindTimestamp(paramName, v); break;
+                case DateTimeOffset v: BindTimestampWithTimeZone(paramName, v); break;
+                case TimeSpan v: BindInterval(paramName, v); break;
+                case byte[] v: BindBlob(paramName, v); break;
+                case KuzuValue v: BindValue(paramName, v); break;
+                default: throw new NotSupportedException($"Parameter '{paramName}' has unsupported type {value.GetType()}");
+            }
+        }
+
         public QueryResult Execute()
         {
             ThrowIfDisposed();
             return _connection.Execute(this);
         }
 
+        /// <summary>
+        /// Executes the statement on a dedicated native-call thread; see <see cref="Connection.QueryAsync"/> for cancellation and timeout behavior.
+        /// </summary>
+        public Task<QueryResult> ExecuteAsync(CancellationToken cancellationToken = default)
+        {
+            ThrowIfDisposed();
+            return _connection.ExecuteAsync(this, cancellationToken);
+        }
+
+        /// <summary>
+        /// Releases the statement, or returns it to the connection's <see cref="PreparedStatementCache"/> for reuse when it
+        /// came from the cache. Call once per <see cref="Connection.Prepare"/>.
+        /// </summary>
         public void Dispose()
+        {
+            var cache = Cache;
+            if (cache != null && cache.Return(this)) return;
+            Release();
+        }
+
+        internal void Release()
         {
             _handle.Dispose();
             GC.SuppressFinalize(this);
         }
 
-        private delegate KuzuState NativeBind<T>(ref KuzuPreparedStatement handle, string paramName, T value);
-        private void Bind<T>(string paramName, T value, NativeBind<T> binder)
+        private IntPtr BindName(string paramName)
         {
             ThrowIfDisposed();
             KuzuGuard.NotNullOrEmpty(paramName, nameof(paramName));
             ValidateHandle();
-            var result = binder(ref _handle.NativeStruct, paramName, value);
+            return ResolveParameterName(paramName);
+        }
+
+        private void CheckBind(KuzuState result, string paramName)
+        {
             if (result != KuzuState.Success)
                 throw new KuzuException($"Failed to bind parameter '{paramName}': {GetErrorMessageSafe()}");
         }
@@ -166,7 +319,7 @@ namespace KuzuDot
         {
             if (!IsValidHandle()) return "Invalid prepared statement handle";
             var ptr = NativeMethods.kuzu_prepared_statement_get_error_message(ref _handle.NativeStruct);
-            return ptr == IntPtr.Zero ? string.Empty : Marshal.PtrToStringAnsi(ptr) ?? string.Empty;
+            return ptr == IntPtr.Zero ? string.Empty : NativeUtil.PtrToStringUtf8(ptr) ?? string.Empty;
         }
         private void ThrowIfDisposed() { if (_handle.IsInvalid) throw new ObjectDisposedException(nameof(PreparedStatement)); }
     }
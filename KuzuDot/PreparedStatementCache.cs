@@ -0,0 +1,123 @@
+using System;
+using System.Collections.Generic;
+using System.Threading;
+
+namespace KuzuDot
+{
+    /// <summary>
+    /// Bounded LRU cache of successfully prepared statements for one <see cref="Connection"/>, keyed by query text.
+    /// A cached statement is leased to one caller at a time: <see cref="Connection.Prepare"/> hands it out and its
+    /// <see cref="PreparedStatement.Dispose"/> returns it. While it is leased, preparing the same text yields a private,
+    /// uncached statement, so concurrent callers never share bindings. Eviction and <see cref="Clear"/> destroy a leased
+    /// statement only when its holder disposes it. A returned statement keeps its last bound values, so rebind every
+    /// parameter before executing it.
+    /// </summary>
+    public sealed class PreparedStatementCache
+    {
+        private readonly Dictionary<string, LinkedListNode<PreparedStatement>> _map;
+        private readonly LinkedList<PreparedStatement> _lru = new LinkedList<PreparedStatement>(); // most recently used first
+        private readonly object _lockObject = new object();
+        private long _hits;
+        private long _misses;
+        private long _evictions;
+
+        internal PreparedStatementCache(int capacity)
+        {
+            if (capacity <= 0) throw new ArgumentOutOfRangeException(nameof(capacity), "Capacity must be positive");
+            Capacity = capacity;
+            _map = new Dictionary<string, LinkedListNode<PreparedStatement>>(capacity, StringComparer.Ordinal);
+        }
+
+        public int Capacity { get; }
+        public int Count { get { lock (_lockObject) return _map.Count; } }
+        public long Hits => Interlocked.Read(ref _hits);
+        public long Misses => Interlocked.Read(ref _misses);
+        public long Evictions => Interlocked.Read(ref _evictions);
+
+        /// <summary>Leases the cached statement for <paramref name="query"/> if it exists and is not already leased.</summary>
+        internal bool TryGet(string query, out PreparedStatement statement)
+        {
+            lock (_lockObject)
+            {
+                if (_map.TryGetValue(query, out var node) && !node.Value.IsLeased)
+                {
+                    if (node != _lru.First)
+                    {
+                        _lru.Remove(node);
+                        _lru.AddFirst(node);
+                    }
+                    _hits++;
+                    node.Value.IsLeased = true;
+                    statement = node.Value;
+                    return true;
+                }
+                _misses++;
+            }
+            statement = null;
+            return false;
+        }
+
+        /// <summary>
+        /// Caches <paramref name="statement"/> leased to the caller, unless the query is already cached (its statement is
+        /// then leased elsewhere), in which case <paramref name="statement"/> stays private to the caller.
+        /// </summary>
+        internal PreparedStatement Add(string query, PreparedStatement statement)
+        {
+            PreparedStatement evicted = null;
+            lock (_lockObject)
+            {
+                if (_map.ContainsKey(query)) return statement;
+                if (_map.Count >= Capacity)
+                {
+                    var last = _lru.Last;
+                    _lru.RemoveLast();
+                    _map.Remove(last.Value.Query);
+                    evicted = Detach(last.Value);
+                    _evictions++;
+                }
+                statement.Cache = this;
+                statement.IsLeased = true;
+                _map.Add(query, _lru.AddFirst(statement));
+            }
+            evicted?.Release();
+            return statement;
+        }
+
+        /// <summary>Ends a lease; false when the statement is no longer cached and the caller must release it.</summary>
+        internal bool Return(PreparedStatement statement)
+        {
+            lock (_lockObject)
+            {
+                if (statement.Cache != this) return false;
+                statement.IsLeased = false;
+                return true;
+            }
+        }
+
+        /// <summary>Removes ownership; returns the statement if it can be released now, or null if its holder will.</summary>
+        private static PreparedStatement Detach(PreparedStatement statement)
+        {
+            statement.Cache = null;
+            return statement.IsLeased ? null : statement;
+        }
+
+        /// <summary>Releases every cached statement that is not leased; leased ones are released when disposed. Counters are kept.</summary>
+        public void Clear()
+        {
+            var released = new List<PreparedStatement>();
+            lock (_lockObject)
+            {
+                foreach (var statement in _lru)
+                {
+                    var idle = Detach(statement);
+                    if (idle != null) released.Add(idle);
+                }
+                _lru.Clear();
+                _map.Clear();
+            }
+            foreach (var statement in released) statement.Release();
+        }
+
+        public override string ToString() => $"PreparedStatementCache(Count={Count}/{Capacity}, Hits={Hits}, Misses={Misses}, Evictions={Evictions})";
+    }
+}
@@ -0,0 +1,70 @@
+using System;
+using System.Collections.Generic;
+using Apache.Arrow;
+using Apache.Arrow.C;
+using KuzuDot.Native;
+
+namespace KuzuDot
+{
+    public partial class QueryResult
+    {
+        /// <summary>
+        /// Imports the Arrow schema of this result as an <see cref="Schema"/>. The native schema is released once imported.
+        /// </summary>
+        public unsafe Schema GetArrowSchema()
+        {
+            ThrowIfDisposed();
+            if (!TryGetArrowSchema(out var native)) throw new KuzuException("Failed to get Arrow schema for query result");
+            var cSchema = CArrowSchema.Create();
+            try
+            {
+                *(ArrowSchema*)cSchema = native; // move: ImportSchema invokes the release callback
+                return CArrowSchemaImporter.ImportSchema(cSchema);
+            }
+            finally
+            {
+                CArrowSchema.Free(cSchema);
+            }
+        }
+
+        /// <summary>
+        /// Streams the remaining tuples as Apache Arrow record batches of up to <paramref name="chunkSize"/> rows.
+        /// Batches wrap the native buffers without copying; each batch releases its native memory when disposed,
+        /// so dispose batches once they have been handed off (e.g. written to Flight or Parquet).
+        /// </summary>
+        public IEnumerable<RecordBatch> ToArrowBatches(long chunkSize = 2048)
+        {
+            ThrowIfDisposed();
+            if (chunkSize <= 0) throw new ArgumentOutOfRangeException(nameof(chunkSize), "Chunk size must be positive");
+            return EnumerateArrowBatches(GetArrowSchema(), chunkSize);
+        }
+
+        private IEnumerable<RecordBatch> EnumerateArrowBatches(Schema schema, long chunkSize)
+        {
+            RecordBatch batch;
+            while ((batch = ImportNextArrowBatch(schema, chunkSize)) != null) yield return batch;
+        }
+
+        private unsafe RecordBatch ImportNextArrowBatch(Schema schema, long chunkSize)
+        {
+            ThrowIfDisposed();
+            if (!HasNext()) return null;
+            if (!TryGetNextArrowChunk(chunkSize, out var native)) throw new KuzuException("Failed to get next Arrow chunk");
+            if (native.length == 0)
+            {
+                ArrowInterop.Release(&native);
+                return null;
+            }
+            var cArray = CArrowArray.Create();
+            try
+            {
+                *(ArrowArray*)cArray = native; // move: the imported batch now owns the release callback
+                return CArrowArrayImporter.ImportRecordBatch(cArray, schema);
+            }
+            finally
+            {
+                CArrowArray.Free(cArray);
+            }
+        }
+    }
+}
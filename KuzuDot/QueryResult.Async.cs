@@ -0,0 +1,133 @@
+using System;
+using System.Collections.Generic;
+using System.Runtime.CompilerServices;
+using System.Threading;
+using System.Threading.Channels;
+using System.Threading.Tasks;
+using KuzuDot.Utils;
+
+namespace KuzuDot
+{
+    public partial class QueryResult
+    {
+        /// <summary>
+        /// Streams the remaining rows, projected through <paramref name="selector"/>, as an async sequence.
+        /// Rows are fetched and projected on a native-call thread into a bounded buffer of <paramref name="capacity"/> items,
+        /// so fetching overlaps with the consumer; fetching pauses while the buffer is full.
+        /// The selector must copy whatever it needs out of the reader, since the row is only valid for the duration of the call.
+        /// Only one enumeration may be active at a time.
+        /// </summary>
+        public IAsyncEnumerable<T> ReadAllAsync<T>(Func<KuzuDataReader, T> selector, int capacity = 256, CancellationToken cancellationToken = default)
+        {
+            KuzuGuard.NotNull(selector, nameof(selector));
+            if (capacity <= 0) throw new ArgumentOutOfRangeException(nameof(capacity), "Capacity must be positive");
+            ThrowIfDisposed();
+            return ReadAllAsyncCore(selector, capacity, cancellationToken);
+        }
+
+        private async IAsyncEnumerable<T> ReadAllAsyncCore<T>(Func<KuzuDataReader, T> selector, int capacity, [EnumeratorCancellation] CancellationToken cancellationToken)
+        {
+            var channel = Channel.CreateBounded<T>(new BoundedChannelOptions(capacity)
+            {
+                SingleReader = true,
+                SingleWriter = true,
+                FullMode = BoundedChannelFullMode.Wait,
+            });
+            using var stop = CancellationTokenSource.CreateLinkedTokenSource(cancellationToken);
+            var producer = ProduceRowsAsync(new RowPump<T>(GetReader(), selector, channel.Writer, capacity), stop.Token);
+            try
+            {
+                var reader = channel.Reader;
+                while (await reader.WaitToReadAsync(cancellationToken).ConfigureAwait(false))
+                {
+                    while (reader.TryRead(out var item)) yield return item;
+                }
+            }
+            finally
+            {
+                // Unblocks a producer waiting on a full buffer when the consumer stops early.
+                stop.Cancel();
+                try { await producer.ConfigureAwait(false); } catch (OperationCanceledException) { }
+            }
+        }
+
+        /// <summary>
+        /// Fetches rows one bounded batch per native-call work item and waits for buffer space between batches off the
+        /// native-call threads, so a slow consumer never parks one of them.
+        /// </summary>
+        private static async Task ProduceRowsAsync<T>(RowPump<T> pump, CancellationToken token)
+        {
+            var writer = pump.Writer;
+            try
+            {
+                while (true)
+                {
+                    if (pump.HasPending)
+                    {
+                        await writer.WriteAsync(pump.TakePending(), token).ConfigureAwait(false);
+                    }
+                    else if (!await writer.WaitToWriteAsync(token).ConfigureAwait(false))
+                    {
+                        return;
+                    }
+                    if (!await NativeCallScheduler.Shared.Run(pump.FillBatch, token).ConfigureAwait(false)) break;
+                }
+                writer.TryComplete();
+            }
+            catch (OperationCanceledException) when (token.IsCancellationRequested)
+            {
+                writer.TryComplete();
+            }
+            catch (Exception ex)
+            {
+                writer.TryComplete(ex);
+            }
+        }
+
+        /// <summary>Cursor state carried between producer work items.</summary>
+        private sealed class RowPump<T>
+        {
+            private readonly Func<KuzuDataReader, T> _selector;
+            private readonly int _batchSize;
+            private KuzuDataReader _reader;
+            private T _pending;
+
+            internal RowPump(KuzuDataReader reader, Func<KuzuDataReader, T> selector, ChannelWriter<T> writer, int batchSize)
+            {
+                _reader = reader;
+                _selector = selector;
+                Writer = writer;
+                _batchSize = batchSize;
+            }
+
+            internal ChannelWriter<T> Writer { get; }
+            internal bool HasPending { get; private set; }
+
+            internal T TakePending()
+            {
+                var item = _pending;
+                _pending = default;
+                HasPending = false;
+                return item;
+            }
+
+            /// <summary>
+            /// Reads up to one batch of rows into the buffer, stopping early when it is full (the unbuffered row is kept
+            /// pending). Returns false once the result is exhausted.
+            /// </summary>
+            internal bool FillBatch()
+            {
+                for (int i = 0; i < _batchSize; i++)
+                {
+                    if (!_reader.Read()) return false;
+                    var item = _selector(_reader);
+                    if (Writer.TryWrite(item)) continue;
+                    _pending = item;
+                    HasPending = true;
+                    return true;
+                }
+                return true;
+            }
+        }
+    }
+}
@@ -1,16 +1,19 @@
 using System;
+using System.Collections.Generic;
 using System.Runtime.InteropServices;
+using System.Threading;
 using KuzuDot.Native;
 using KuzuDot.Native.Enums;
 using KuzuDot.Utils;
 
 namespace KuzuDot
 {
-    public class QueryResult : IDisposable
+    public partial class QueryResult : IDisposable
     {
         private sealed class QueryResultSafeHandle : SafeHandle
         {
             internal bool IsOwnedByCpp;
+            internal IntPtr Utf8Scratch; // last string handed out by KuzuDataReader.GetStringUtf8
             internal QueryResultSafeHandle() : base(IntPtr.Zero, true) { }
             public override bool IsInvalid => handle == IntPtr.Zero;
             internal void Initialize(IntPtr ptr) { SetHandle(ptr); }
@@ -18,6 +21,7 @@ namespace KuzuDot
             {
                 try
                 {
+                    FreeUtf8Scratch();
                     if (!IsInvalid && !IsOwnedByCpp)
                     {
                         var native = new KuzuQueryResult { QueryResult = handle };
@@ -28,9 +32,21 @@ namespace KuzuDot
                 }
                 catch { return false; }
             }
+
+            internal void FreeUtf8Scratch()
+            {
+                var scratch = Utf8Scratch;
+                Utf8Scratch = IntPtr.Zero;
+                if (scratch != IntPtr.Zero) NativeMethods.kuzu_destroy_string(scratch);
+            }
         }
 
         private readonly QueryResultSafeHandle _handle = new QueryResultSafeHandle();
+        private ulong? _numColumns;
+        private KuzuDataTypeId[] _columnTypeIds;
+        private string[] _columnNames;
+        private GraphSchemaCache _graphSchemas;
+        private long _rowVersion;
 
         internal QueryResult(KuzuQueryResult nativeHandle)
         {
@@ -54,7 +70,8 @@ namespace KuzuDot
         }
 
         private KuzuQueryResult AsStruct() => new KuzuQueryResult { QueryResult = _handle.DangerousGetHandle(), IsOwnedByCpp = _handle.IsOwnedByCpp };
-        private void ThrowIfDisposed() { if (_handle.IsInvalid) throw new ObjectDisposedException(nameof(QueryResult)); }
+        internal bool IsDisposed => _handle.IsInvalid;
+        internal void ThrowIfDisposed() { if (_handle.IsInvalid) throw new ObjectDisposedException(nameof(QueryResult)); }
 
         public bool IsSuccess
         {
@@ -79,8 +96,11 @@ namespace KuzuDot
             get
             {
                 ThrowIfDisposed();
+                if (_numColumns is ulong cached) return cached; // column count is fixed for the lifetime of a result
                 var s = AsStruct();
-                return NativeMethods.kuzu_query_result_get_num_columns(ref s);
+                var n = NativeMethods.kuzu_query_result_get_num_columns(ref s);
+                _numColumns = n;
+                return n;
             }
         }
 
@@ -112,15 +132,110 @@ namespace KuzuDot
         }
 
         public FlatTuple GetNext()
+        {
+            var tupleHandle = default(KuzuFlatTuple);
+            if (!TryReadNext(ref tupleHandle)) throw new InvalidOperationException("No more tuples available");
+            var flatTuple = new FlatTuple(tupleHandle) { Size = GetNumColumns(), GraphSchemas = GraphSchemas };
+            return flatTuple;
+        }
+
+        /// <summary>
+        /// Returns a forward-only row cursor over the remaining tuples of this result.
+        /// The cursor caches the column count and types once and reuses the engine's tuple for every row,
+        /// so no managed objects are allocated per row. The cursor is only valid while this result is alive.
+        /// </summary>
+        public KuzuDataReader GetReader()
         {
             ThrowIfDisposed();
-            if (!HasNext()) throw new InvalidOperationException("No more tuples available");
+            return new KuzuDataReader(this);
+        }
+
+        /// <summary>
+        /// Advances the native iterator. The engine reuses a single tuple for all calls, so the returned
+        /// handle is borrowed (owned by C++) and is overwritten by the next call.
+        /// </summary>
+        internal bool TryReadNext(ref KuzuFlatTuple tuple)
+        {
+            ThrowIfDisposed();
+            _handle.FreeUtf8Scratch();
+            _rowVersion++;
             var s = AsStruct();
-            var result = NativeMethods.kuzu_query_result_get_next(ref s, out var tupleHandle);
+            if (!NativeMethods.kuzu_query_result_has_next(ref s)) return false;
+            var result = NativeMethods.kuzu_query_result_get_next(ref s, out tuple);
             if (result != KuzuState.Success) throw new KuzuException("Failed to get next tuple");
-            tupleHandle.IsOwnedByCpp = true;
-            var flatTuple = new FlatTuple(tupleHandle) { Size = GetNumColumns() };
-            return flatTuple;
+            tuple.IsOwnedByCpp = true;
+            return true;
+        }
+
+        /// <summary>
+        /// Maps the remaining rows to <typeparamref name="T"/> by column name. The mapping delegate is compiled once per
+        /// result shape and <typeparamref name="T"/> and reads each cell through its typed accessor; see
+        /// <see cref="KuzuDataReader"/>. Rows are produced lazily while enumerating, so this result must stay alive until then.
+        /// </summary>
+        /// <exception cref="NotSupportedException">A column cannot be converted to the matching member of <typeparamref name="T"/>.</exception>
+        public IEnumerable<T> As<T>()
+        {
+            ThrowIfDisposed();
+            var map = RowMaterializer<T>.For(this);
+            return AsCore(map);
+        }
+
+        private IEnumerable<T> AsCore<T>(Func<KuzuDataReader, T> map)
+        {
+            var reader = GetReader();
+            while (reader.Read()) yield return map(reader);
+        }
+
+        /// <summary>Takes ownership of a native string for <see cref="KuzuDataReader.GetStringUtf8"/>, freeing the previous one.</summary>
+        internal void SetUtf8Scratch(IntPtr str)
+        {
+            _handle.FreeUtf8Scratch();
+            _handle.Utf8Scratch = str;
+        }
+
+        internal KuzuDataTypeId[] ColumnTypeIds
+        {
+            get
+            {
+                if (_columnTypeIds != null) return _columnTypeIds;
+                ThrowIfDisposed();
+                var ids = new KuzuDataTypeId[NumColumns];
+                var s = AsStruct();
+                for (ulong i = 0; i < (ulong)ids.Length; i++)
+                {
+                    var state = NativeMethods.kuzu_query_result_get_column_data_type(ref s, i, out KuzuLogicalTypeNative dataType);
+                    if (state != KuzuState.Success) throw new KuzuException($"Failed to get column data type at index {i}");
+                    try { ids[i] = NativeMethods.kuzu_data_type_get_id(ref dataType); }
+                    finally { NativeMethods.kuzu_data_type_destroy(ref dataType); }
+                }
+                _columnTypeIds = ids;
+                return ids;
+            }
+        }
+
+        /// <summary>Bumped on every cursor advance; lets row-bound views (<see cref="KuzuNodeView"/>) detect a stale row.</summary>
+        internal long RowVersion => _rowVersion;
+
+        /// <summary>Node/rel property layouts seen in this result; the schema is fixed for the result's lifetime.</summary>
+        internal GraphSchemaCache GraphSchemas
+        {
+            get
+            {
+                if (Volatile.Read(ref _graphSchemas) == null) Interlocked.CompareExchange(ref _graphSchemas, new GraphSchemaCache(), null);
+                return _graphSchemas;
+            }
+        }
+
+        internal string[] ColumnNames
+        {
+            get
+            {
+                if (_columnNames != null) return _columnNames;
+                var names = new string[NumColumns];
+                for (ulong i = 0; i < (ulong)names.Length; i++) names[i] = GetColumnName(i);
+                _columnNames = names;
+                return names;
+            }
         }
 
         public bool HasNextQueryResult()
@@ -148,6 +263,10 @@ namespace KuzuDot
             return new QuerySummary(summaryHandle);
         }
 
+        /// <summary>
+        /// Gets the raw Arrow schema of this result. The caller owns the struct and is responsible for invoking its
+        /// <c>release</c> callback; prefer <see cref="GetArrowReader"/>, which does this deterministically.
+        /// </summary>
         public bool TryGetArrowSchema(out ArrowSchema schema)
         {
             ThrowIfDisposed();
@@ -156,6 +275,10 @@ namespace KuzuDot
             return state == KuzuState.Success;
         }
 
+        /// <summary>
+        /// Gets the next raw Arrow chunk of this result. The caller owns the struct and is responsible for invoking its
+        /// <c>release</c> callback; prefer <see cref="GetArrowReader"/>, which does this deterministically.
+        /// </summary>
         public bool TryGetNextArrowChunk(long chunkSize, out ArrowArray array)
         {
             ThrowIfDisposed();
@@ -164,6 +287,16 @@ namespace KuzuDot
             return state == KuzuState.Success;
         }
 
+        /// <summary>
+        /// Returns a columnar reader that fetches the remaining tuples as Arrow chunks of up to <paramref name="chunkSize"/> rows.
+        /// Columns are exposed as spans over the native buffers, which are released when each chunk (and the reader) is disposed.
+        /// </summary>
+        public ArrowResultReader GetArrowReader(long chunkSize = 2048)
+        {
+            ThrowIfDisposed();
+            return new ArrowResultReader(this, chunkSize);
+        }
+
         public override string ToString()
         {
             if (_handle.IsInvalid) return string.Empty;
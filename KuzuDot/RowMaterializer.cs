@@ -0,0 +1,190 @@
+using System;
+using System.Collections.Concurrent;
+using System.Globalization;
+using System.Linq;
+using System.Linq.Expressions;
+using System.Reflection;
+using System.Text;
+using KuzuDot.Native.Enums;
+
+namespace KuzuDot
+{
+    /// <summary>
+    /// Builds and caches a compiled row-to-<typeparamref name="T"/> delegate per result shape (column names and types).
+    /// Columns bind to public settable properties/fields by name (case-insensitive), or to the parameters of the widest
+    /// public constructor when <typeparamref name="T"/> has no parameterless one. Each cell is read through the typed
+    /// <see cref="KuzuDataReader"/> accessor for its column type, so no <see cref="KuzuValue"/> or boxing occurs per row.
+    /// Columns without a matching member are ignored; null cells leave the member at its default.
+    /// </summary>
+    internal static class RowMaterializer<T>
+    {
+        private static readonly ConcurrentDictionary<string, Func<KuzuDataReader, T>> Cache = new ConcurrentDictionary<string, Func<KuzuDataReader, T>>(StringComparer.Ordinal);
+
+        internal static Func<KuzuDataReader, T> For(QueryResult result)
+        {
+            var names = result.ColumnNames;
+            var types = result.ColumnTypeIds;
+            return Cache.GetOrAdd(ShapeKey(names, types), _ => Compile(names, types));
+        }
+
+        private static string ShapeKey(string[] names, KuzuDataTypeId[] types)
+        {
+            var sb = new StringBuilder();
+            for (int i = 0; i < names.Length; i++) sb.Append(names[i]).Append('\u001F').Append((uint)types[i]).Append('\u001E');
+            return sb.ToString();
+        }
+
+        private static Func<KuzuDataReader, T> Compile(string[] names, KuzuDataTypeId[] types)
+        {
+            var reader = Expression.Parameter(typeof(KuzuDataReader), "reader");
+            var target = typeof(T);
+            var ctor = target.IsValueType ? null : target.GetConstructor(Type.EmptyTypes);
+            if (target.IsValueType || ctor != null) return CompileMemberInit(reader, names, types, ctor);
+            return CompileConstructor(reader, names, types);
+        }
+
+        private static Func<KuzuDataReader, T> CompileMemberInit(ParameterExpression reader, string[] names, KuzuDataTypeId[] types, ConstructorInfo ctor)
+        {
+            var instance = Expression.Variable(typeof(T), "row");
+            var body = new System.Collections.Generic.List<Expression>
+            {
+                Expression.Assign(instance, ctor != null ? Expression.New(ctor) : (Expression)Expression.Default(typeof(T))),
+            };
+            for (int i = 0; i < names.Length; i++)
+            {
+                var member = FindMember(names[i]);
+                if (member == null) continue;
+                var memberType = member is PropertyInfo p ? p.PropertyType : ((FieldInfo)member).FieldType;
+                var access = Expression.MakeMemberAccess(instance, member);
+                body.Add(Expression.IfThen(
+                    Expression.Not(IsNull(reader, i)),
+                    Expression.Assign(access, ReadCell(reader, i, types[i], memberType, names[i]))));
+            }
+            body.Add(instance);
+            return Expression.Lambda<Func<KuzuDataReader, T>>(Expression.Block(new[] { instance }, body), reader).Compile();
+        }
+
+        private static Func<KuzuDataReader, T> CompileConstructor(ParameterExpression reader, string[] names, KuzuDataTypeId[] types)
+        {
+            var ctor = typeof(T).GetConstructors()
+                .Where(c => c.GetParameters().All(p => IndexOf(names, p.Name) >= 0))
+                .OrderByDescending(c => c.GetParameters().Length)
+                .FirstOrDefault();
+            if (ctor == null)
+                throw new NotSupportedException($"Type {typeof(T)} has no parameterless constructor and no public constructor whose parameters all match result columns");
+            var args = ctor.GetParameters().Select(p =>
+            {
+                var i = IndexOf(names, p.Name);
+                return (Expression)Expression.Condition(IsNull(reader, i), Expression.Default(p.ParameterType), ReadCell(reader, i, types[i], p.ParameterType, names[i]));
+            });
+            return Expression.Lambda<Func<KuzuDataReader, T>>(Expression.New(ctor, args), reader).Compile();
+        }
+
+        private static MemberInfo FindMember(string column)
+        {
+            const BindingFlags flags = BindingFlags.Public | BindingFlags.Instance | BindingFlags.IgnoreCase;
+            var property = typeof(T).GetProperty(column, flags);
+            if (property != null && property.CanWrite && property.GetIndexParameters().Length == 0) return property;
+            var field = typeof(T).GetField(column, flags);
+            return field != null && !field.IsInitOnly ? field : null;
+        }
+
+        private static int IndexOf(string[] names, string name)
+        {
+            for (int i = 0; i < names.Length; i++) if (string.Equals(names[i], name, StringComparison.OrdinalIgnoreCase)) return i;
+            return -1;
+        }
+
+        private static Expression IsNull(ParameterExpression reader, int ordinal)
+            => Expression.Call(reader, typeof(KuzuDataReader).GetMethod(nameof(KuzuDataReader.IsNull)), Expression.Constant(ordinal));
+
+        /// <summary>Reads cell <paramref name="ordinal"/> with the accessor for its column type and converts it to <paramref name="memberType"/>.</summary>
+        private static Expression ReadCell(ParameterExpression reader, int ordinal, KuzuDataTypeId columnType, Type memberType, string column)
+        {
+            var targetType = Nullable.GetUnderlyingType(memberType) ?? memberType;
+            var index = Expression.Constant(ordinal);
+            Expression value;
+            var getter = GetterFor(columnType);
+            if (getter == null)
+            {
+                // Nested/graph types have no typed accessor; they can only be materialized as their text form.
+                if (targetType != typeof(string)) throw Unsupported(column, columnType, memberType);
+                value = Expression.Call(reader, typeof(KuzuDataReader).GetMethod(nameof(KuzuDataReader.GetCellText), BindingFlags.NonPublic | BindingFlags.Instance), index);
+            }
+            else
+            {
+                value = Expression.Call(reader, getter, index);
+            }
+            value = Convert(value, targetType, column, columnType, memberType);
+            return value.Type == memberType ? value : Expression.Convert(value, memberType);
+        }
+
+        private static Expression Convert(Expression value, Type targetType, string column, KuzuDataTypeId columnType, Type memberType)
+        {
+            if (value.Type == targetType) return value;
+            if (value.Type == typeof(string))
+            {
+                if (targetType == typeof(decimal)) return Expression.Call(typeof(decimal).GetMethod(nameof(decimal.Parse), new[] { typeof(string), typeof(IFormatProvider) }), value, Expression.Constant(CultureInfo.InvariantCulture, typeof(IFormatProvider)));
+                if (targetType == typeof(Guid)) return Expression.Call(typeof(Guid).GetMethod(nameof(Guid.Parse), new[] { typeof(string) }), value);
+            }
+            if (value.Type == typeof(DateTime) && targetType == typeof(DateTimeOffset)) return Expression.New(typeof(DateTimeOffset).GetConstructor(new[] { typeof(DateTime) }), value);
+            if (IsNumeric(value.Type) && IsNumeric(targetType)) return Expression.ConvertChecked(value, targetType);
+            if (targetType.IsEnum && IsNumeric(value.Type)) return Expression.Convert(Expression.ConvertChecked(value, Enum.GetUnderlyingType(targetType)), targetType);
+            if (targetType.IsAssignableFrom(value.Type)) return Expression.Convert(value, targetType);
+            throw Unsupported(column, columnType, memberType);
+        }
+
+        private static MethodInfo GetterFor(KuzuDataTypeId columnType)
+        {
+            string name;
+            switch (columnType)
+            {
+                case KuzuDataTypeId.Bool: name = nameof(KuzuDataReader.GetBool); break;
+                case KuzuDataTypeId.Int8: name = nameof(KuzuDataReader.GetInt8); break;
+                case KuzuDataTypeId.Int16: name = nameof(KuzuDataReader.GetInt16); break;
+                case KuzuDataTypeId.Int32: name = nameof(KuzuDataReader.GetInt32); break;
+                case KuzuDataTypeId.Int64:
+                case KuzuDataTypeId.Serial: name = nameof(KuzuDataReader.GetInt64); break;
+                case KuzuDataTypeId.UInt8: name = nameof(KuzuDataReader.GetUInt8); break;
+                case KuzuDataTypeId.UInt16: name = nameof(KuzuDataReader.GetUInt16); break;
+                case KuzuDataTypeId.UInt32: name = nameof(KuzuDataReader.GetUInt32); break;
+                case KuzuDataTypeId.UInt64: name = nameof(KuzuDataReader.GetUInt64); break;
+                case KuzuDataTypeId.Int128: name = nameof(KuzuDataReader.GetBigInteger); break;
+                case KuzuDataTypeId.Float: name = nameof(KuzuDataReader.GetFloat); break;
+                case KuzuDataTypeId.Double: name = nameof(KuzuDataReader.GetDouble); break;
+                case KuzuDataTypeId.Date:
+                case KuzuDataTypeId.Timestamp:
+                case KuzuDataTypeId.TimestampSec:
+                case KuzuDataTypeId.TimestampMs:
+                case KuzuDataTypeId.TimestampNs:
+                case KuzuDataTypeId.TimestampTz: name = nameof(KuzuDataReader.GetDateTime); break;
+                case KuzuDataTypeId.Interval: name = nameof(KuzuDataReader.GetInterval); break;
+                case KuzuDataTypeId.InternalId: name = nameof(KuzuDataReader.GetInternalId); break;
+                case KuzuDataTypeId.String:
+                case KuzuDataTypeId.Decimal:
+                case KuzuDataTypeId.Uuid: name = nameof(KuzuDataReader.GetString); break;
+                case KuzuDataTypeId.Blob: name = nameof(KuzuDataReader.GetBlob); break;
+                default: return null;
+            }
+            return typeof(KuzuDataReader).GetMethod(name, new[] { typeof(int) });
+        }
+
+        private static bool IsNumeric(Type type)
+        {
+            switch (Type.GetTypeCode(type))
+            {
+                case TypeCode.SByte: case TypeCode.Byte:
+                case TypeCode.Int16: case TypeCode.UInt16:
+                case TypeCode.Int32: case TypeCode.UInt32:
+                case TypeCode.Int64: case TypeCode.UInt64:
+                case TypeCode.Single: case TypeCode.Double: case TypeCode.Decimal:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+
+        private static NotSupportedException Unsupported(string column, KuzuDataTypeId columnType, Type memberType)
+            => new NotSupportedException($"Column '{column}' of type {columnType} cannot be mapped to {memberType} on {typeof(T)}");
+    }
+}
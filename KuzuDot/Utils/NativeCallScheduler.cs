@@ -0,0 +1,60 @@
+using System;
+using System.Collections.Concurrent;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace KuzuDot.Utils
+{
+    /// <summary>
+    /// Runs blocking native calls on a fixed set of dedicated background threads so that async callers
+    /// do not tie up ThreadPool threads for the duration of a query.
+    /// </summary>
+    internal sealed class NativeCallScheduler
+    {
+        internal static readonly NativeCallScheduler Shared = new NativeCallScheduler(Math.Max(2, Environment.ProcessorCount));
+
+        private readonly BlockingCollection<Action> _queue = new BlockingCollection<Action>();
+
+        internal NativeCallScheduler(int threadCount)
+        {
+            if (threadCount <= 0) throw new ArgumentOutOfRangeException(nameof(threadCount));
+            ThreadCount = threadCount;
+            for (int i = 0; i < threadCount; i++)
+            {
+                new Thread(Work) { IsBackground = true, Name = "KuzuDot native call #" + i }.Start();
+            }
+        }
+
+        internal int ThreadCount { get; }
+
+        /// <summary>
+        /// Queues <paramref name="call"/> on a native-call thread. Cancelling <paramref name="cancellationToken"/> while the call
+        /// is still queued cancels the task without running it; once running, the call itself is responsible for observing it.
+        /// Continuations run asynchronously so awaiting code never executes on a native-call thread.
+        /// </summary>
+        internal Task<T> Run<T>(Func<T> call, CancellationToken cancellationToken)
+        {
+            var tcs = new TaskCompletionSource<T>(TaskCreationOptions.RunContinuationsAsynchronously);
+            if (cancellationToken.IsCancellationRequested)
+            {
+                tcs.TrySetCanceled(cancellationToken);
+                return tcs.Task;
+            }
+            var registration = cancellationToken.Register(() => tcs.TrySetCanceled(cancellationToken));
+            _queue.Add(() =>
+            {
+                registration.Dispose(); // waits for an in-flight cancel callback, so the check below is final
+                if (tcs.Task.IsCompleted) return;
+                try { tcs.TrySetResult(call()); }
+                catch (OperationCanceledException ex) { tcs.TrySetCanceled(ex.CancellationToken); }
+                catch (Exception ex) { tcs.TrySetException(ex); }
+            });
+            return tcs.Task;
+        }
+
+        private void Work()
+        {
+            foreach (var item in _queue.GetConsumingEnumerable()) item();
+        }
+    }
+}
@@ -0,0 +1,63 @@
+using System;
+
+namespace KuzuDot.Utils
+{
+    /// <summary>
+    /// Conservative, allocation-free check for statements that may modify the database, used to bump
+    /// <see cref="Database.WriteGeneration"/>. It looks for write keywords as whole words anywhere in the text (including
+    /// string literals), so it can report false positives but never misses a write clause.
+    /// </summary>
+    internal static class StatementClassifier
+    {
+        private static readonly string[] WriteKeywords =
+        {
+            "CREATE", "MERGE", "SET", "DELETE", "DETACH", "REMOVE", "COPY", "DROP", "ALTER", "IMPORT", "COMMIT", "ROLLBACK",
+        };
+
+        public static bool MayWrite(string query) => query == null || MayWrite(query.AsSpan());
+
+        public static bool MayWrite(ReadOnlySpan<char> query)
+        {
+            int i = 0;
+            while (i < query.Length)
+            {
+                if (!IsWordChar(query[i])) { i++; continue; }
+                int start = i;
+                while (i < query.Length && IsWordChar(query[i])) i++;
+                if (IsWriteKeyword(query.Slice(start, i - start))) return true;
+            }
+            return false;
+        }
+
+        /// <summary>UTF-8 overload; keywords are ASCII, so multi-byte sequences never match.</summary>
+        public static bool MayWrite(ReadOnlySpan<byte> utf8Query)
+        {
+            Span<char> word = stackalloc char[8];
+            int i = 0;
+            while (i < utf8Query.Length)
+            {
+                if (!IsWordChar((char)utf8Query[i])) { i++; continue; }
+                int start = i;
+                while (i < utf8Query.Length && IsWordChar((char)utf8Query[i])) i++;
+                int length = i - start;
+                if (length > word.Length) continue;
+                for (int k = 0; k < length; k++) word[k] = (char)utf8Query[start + k];
+                if (IsWriteKeyword(word.Slice(0, length))) return true;
+            }
+            return false;
+        }
+
+        private static bool IsWriteKeyword(ReadOnlySpan<char> word)
+        {
+            if (word.Length < 3 || word.Length > 8) return false;
+            foreach (var keyword in WriteKeywords)
+            {
+                if (word.Equals(keyword.AsSpan(), StringComparison.OrdinalIgnoreCase)) return true;
+            }
+            return false;
+        }
+
+        // Bytes >= 0x80 are treated as word characters so UTF-8 identifiers are skipped whole.
+        private static bool IsWordChar(char c) => c == '_' || c >= 0x80 || (c >= '0' && c <= '9') || ((c | 0x20) >= 'a' && (c | 0x20) <= 'z');
+    }
+}
@@ -24,7 +24,7 @@ namespace KuzuDot
             try
             {
                 // Marshal the string pointer to a managed string
-                var versionString = Marshal.PtrToStringAnsi(versionPtr);
+                var versionString = NativeUtil.PtrToStringUtf8(versionPtr);
 
                 // Check if the marshaled string is null
                 if (versionString == null)